@@ -0,0 +1,187 @@
+/**
+ * @file    bench_bipbuffer.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    17-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * SBipBuffer throughput with mixed reservation sizes (16 bytes to 4 KB):
+ * a producer writes each block with a single memcpy() to a contiguous
+ * reservation and a consumer releases up to 8 KB at a time when the buffer
+ * is full. A SQueue of bytes, where a block has to be pushed element by
+ * element (it can be split at the end of the buffer), is the reference.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2022 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ libraries
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+// Static Queue
+#include "sbipbuffer.hpp"
+#include "squeue.hpp"
+
+// Benchmark helpers
+#include "sbench.hpp"
+
+/*****************************************************************************/
+
+/* Benchmark Configuration */
+
+static const uint32_t BUFFER_BYTES = 65536U;
+
+static const uint32_t MAX_BLOCK = 4096U;
+
+static const uint32_t CONSUME_BYTES = 8192U;
+
+static const uint32_t NUM_SIZES = 4096U;
+
+/**
+ * @brief Number of blocks written on each measure.
+ */
+static const uint32_t BLOCKS = 65536U;
+
+/*****************************************************************************/
+
+/* Benchmark Data */
+
+static SBipBuffer<uint8_t, BUFFER_BYTES> bip;
+
+static SQueue<uint8_t, BUFFER_BYTES> queue;
+
+static uint32_t sizes[NUM_SIZES];
+
+static uint8_t block[MAX_BLOCK];
+
+/*****************************************************************************/
+
+/* Benchmark Helpers */
+
+/**
+ * @brief Generate the block sizes: mostly small blocks, with some large
+ * ones.
+ */
+static void make_sizes(uint64_t* total)
+{
+    uint32_t state = 12345U;
+
+    *total = 0U;
+    for ( uint32_t i = 0U; i < NUM_SIZES; i++ )
+    {
+        uint32_t r;
+
+        state = (state * 1664525U) + 1013904223U;
+        r = state >> 12;
+        sizes[i] = ( (r % 4U) == 0U ) ? (512U + (r % (MAX_BLOCK - 511U))) :
+                (16U + (r % 241U));
+    }
+    for ( uint32_t i = 0U; i < BLOCKS; i++ )
+        *total = *total + sizes[i % NUM_SIZES];
+}
+
+/*****************************************************************************/
+
+/* Main Function */
+
+int main()
+{
+    uint64_t total = 0U;
+    uint64_t consumed = 0U;
+    bool ok = true;
+    double ns;
+
+    make_sizes(&total);
+    std::memset(block, 1, sizeof(block));
+
+    std::printf("\nBlocks of 16 B to 4 KB (%u bytes on average) through a "
+            "64 KB buffer\n",
+            static_cast<unsigned>(total / BLOCKS));
+
+    ns = sbench_measure(
+        [&]()
+        {
+            bip.clear();
+            consumed = 0U;
+        },
+        [&]()
+        {
+            for ( uint32_t i = 0U; i < BLOCKS; i++ )
+            {
+                uint32_t size = sizes[i % NUM_SIZES];
+                uint8_t* data = bip.reserve(size);
+
+                while ( data == nullptr )
+                {
+                    uint32_t n;
+                    const uint8_t* read = bip.get_block(&n);
+                    n = ( n > CONSUME_BYTES ) ? CONSUME_BYTES : n;
+                    for ( uint32_t j = 0U; j < n; j = j + 64U )
+                        consumed = consumed + read[j];
+                    bip.release(n);
+                    data = bip.reserve(size);
+                }
+                std::memcpy(data, block, size);
+                bip.commit(size);
+            }
+            SBENCH_KEEP(consumed);
+        }, BLOCKS);
+    ok = ok && (consumed > 0U);
+    sbench_report("SBipBuffer reserve()/memcpy()/commit()", ns);
+    std::printf("%-48s %10.2f GB/s\n", "",
+            static_cast<double>(total) / (ns * BLOCKS));
+
+    ns = sbench_measure(
+        [&]()
+        {
+            queue.clear();
+            consumed = 0U;
+        },
+        [&]()
+        {
+            for ( uint32_t i = 0U; i < BLOCKS; i++ )
+            {
+                uint32_t size = sizes[i % NUM_SIZES];
+
+                if ( (queue.capacity() - queue.size()) < size )
+                {
+                    queue.drain(
+                        [&](const uint8_t& value)
+                        { consumed = consumed + value; }, CONSUME_BYTES);
+                }
+                for ( uint32_t j = 0U; j < size; j++ )
+                    queue.push(block[j]);
+            }
+            SBENCH_KEEP(consumed);
+        }, BLOCKS);
+    ok = ok && (consumed > 0U);
+    sbench_report("SQueue<uint8_t> push() per byte", ns);
+    std::printf("%-48s %10.2f GB/s\n", "",
+            static_cast<double>(total) / (ns * BLOCKS));
+
+    return ( ok ) ? 0 : 1;
+}
+
+/*****************************************************************************/
@@ -0,0 +1,215 @@
+/**
+ * @file    bench_bytequeue.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    17-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * SByteQueue against a SQueue of max size message structs, with the same
+ * buffer memory (64 KB) and a telemetry like distribution of message sizes
+ * (70% of 16 to 64 bytes, 25% of 64 to 256 bytes and 5% of 256 to 1020
+ * bytes): number of messages that fit in the buffer, and write plus read
+ * throughput of batches of 32 messages.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2022 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ libraries
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+// Static Queue
+#include "sbytequeue.hpp"
+#include "squeue.hpp"
+
+// Benchmark helpers
+#include "sbench.hpp"
+
+/*****************************************************************************/
+
+/* Benchmark Configuration */
+
+static const uint32_t BUFFER_BYTES = 65536U;
+
+static const uint32_t MAX_MESSAGE = 1020U;
+
+static const uint32_t NUM_SIZES = 4096U;
+
+static const uint32_t BATCH = 32U;
+
+/**
+ * @brief Number of batches on each measure.
+ */
+static const uint32_t BATCHES = 8192U;
+
+/*****************************************************************************/
+
+/* Benchmark Data Types */
+
+/**
+ * @brief Max size message, as stored by a SQueue.
+ */
+struct t_message
+{
+    uint32_t size;
+    uint8_t data[MAX_MESSAGE];
+};
+
+static const uint32_t NUM_MESSAGES = BUFFER_BYTES / sizeof(t_message);
+
+static SByteQueue<BUFFER_BYTES> byte_queue;
+
+static SQueue<t_message, NUM_MESSAGES> struct_queue;
+
+static uint32_t sizes[NUM_SIZES];
+
+static uint8_t payload[MAX_MESSAGE];
+
+/*****************************************************************************/
+
+/* Benchmark Helpers */
+
+/**
+ * @brief Generate the message sizes.
+ */
+static void make_sizes()
+{
+    uint32_t state = 12345U;
+
+    for ( uint32_t i = 0U; i < NUM_SIZES; i++ )
+    {
+        uint32_t kind, r;
+
+        state = (state * 1664525U) + 1013904223U;
+        kind = (state >> 8) % 100U;
+        r = state >> 16;
+        if ( kind < 70U )
+            sizes[i] = 16U + (r % 49U);
+        else if ( kind < 95U )
+            sizes[i] = 64U + (r % 193U);
+        else
+            sizes[i] = 256U + (r % (MAX_MESSAGE - 255U));
+    }
+}
+
+/*****************************************************************************/
+
+/* Main Function */
+
+int main()
+{
+    uint64_t fitted_bytes = 0U;
+    uint32_t fitted = 0U;
+    uint32_t average = 0U;
+    double ns;
+
+    make_sizes();
+    std::memset(payload, 0x3C, sizeof(payload));
+    for ( uint32_t i = 0U; i < NUM_SIZES; i++ )
+        average = average + sizes[i];
+    average = average / NUM_SIZES;
+
+    // Memory efficiency
+    while ( byte_queue.push(payload, sizes[fitted % NUM_SIZES]) )
+    {
+        fitted_bytes = fitted_bytes + sizes[fitted % NUM_SIZES];
+        fitted = fitted + 1U;
+    }
+    byte_queue.clear();
+
+    std::printf("\nMessages that fit in %u bytes (average message of %u "
+            "bytes)\n", static_cast<unsigned>(BUFFER_BYTES),
+            static_cast<unsigned>(average));
+    std::printf("%-40s %8u messages %6.1f%% payload\n",
+            "SByteQueue<65536>", static_cast<unsigned>(fitted),
+            (100.0 * fitted_bytes) / BUFFER_BYTES);
+    std::printf("%-40s %8u messages %6.1f%% payload\n",
+            "SQueue<max size struct, 64>",
+            static_cast<unsigned>(NUM_MESSAGES),
+            (100.0 * NUM_MESSAGES * average) / sizeof(struct_queue));
+
+    // Throughput
+    sbench_title("Write and read of batches of 32 messages (ns per message)");
+
+    ns = sbench_measure(
+        [&]()
+        {
+            uint32_t n = 0U;
+            uint32_t check = 0U;
+
+            for ( uint32_t b = 0U; b < BATCHES; b++ )
+            {
+                for ( uint32_t i = 0U; i < BATCH; i++ )
+                {
+                    uint32_t size = sizes[(n + i) % NUM_SIZES];
+                    uint8_t* record = byte_queue.try_write(size);
+                    std::memcpy(record, payload, size);
+                    byte_queue.commit(size);
+                }
+                for ( uint32_t i = 0U; i < BATCH; i++ )
+                {
+                    uint32_t size = 0U;
+                    const uint8_t* record = byte_queue.front(&size);
+                    check = check + record[size - 1U] + size;
+                    byte_queue.pop();
+                }
+                n = n + BATCH;
+            }
+            SBENCH_KEEP(check);
+        }, BATCHES * BATCH);
+    sbench_report("SByteQueue try_write()/commit()", ns);
+
+    ns = sbench_measure(
+        [&]()
+        {
+            uint32_t n = 0U;
+            uint32_t check = 0U;
+            t_message message;
+
+            for ( uint32_t b = 0U; b < BATCHES; b++ )
+            {
+                for ( uint32_t i = 0U; i < BATCH; i++ )
+                {
+                    message.size = sizes[(n + i) % NUM_SIZES];
+                    std::memcpy(message.data, payload, message.size);
+                    struct_queue.push(message);
+                }
+                for ( uint32_t i = 0U; i < BATCH; i++ )
+                {
+                    const t_message* record = struct_queue.front();
+                    check = check + record->data[record->size - 1U] +
+                            record->size;
+                    struct_queue.pop();
+                }
+                n = n + BATCH;
+            }
+            SBENCH_KEEP(check);
+        }, BATCHES * BATCH);
+    sbench_report("SQueue<max size struct> push()", ns);
+
+    return 0;
+}
+
+/*****************************************************************************/
@@ -0,0 +1,195 @@
+/**
+ * @file    bench_compactqueue.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    17-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * SQueue compact indexes: sizeof table of the current SQueue against the
+ * previous layout (32 bits head, tail and counter indexes), and push/pop
+ * throughput on 100k small per connection Queues accessed in random order,
+ * where the smaller Queues fit better in the CPU caches.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2022 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ libraries
+#include <cstdint>
+#include <cstdio>
+
+// Static Queue
+#include "squeue.hpp"
+
+// Benchmark helpers
+#include "sbench.hpp"
+
+/*****************************************************************************/
+
+/* Benchmark Configuration */
+
+static const uint32_t NUM_QUEUES = 100000U;
+
+/**
+ * @brief Number of Queue events (push and pop) on each measure.
+ */
+static const uint32_t EVENTS = 4000000U;
+
+/*****************************************************************************/
+
+/* Previous SQueue Layout */
+
+/**
+ * @brief SQueue as it was before the compact indexes (three 32 bits
+ * indexes and the overflow flag), with just the benchmarked methods.
+ */
+template <typename T_QUEUE_ELEMENTS, uint32_t QUEUE_SIZE>
+class t_legacy_queue
+{
+    public:
+
+        t_legacy_queue() : queue_head(0U), queue_tail(0U),
+            num_elements_stored(0U), buffer_overflow(false) {}
+
+        bool empty() const { return ( num_elements_stored == 0U ); }
+
+        uint32_t size() const { return num_elements_stored; }
+
+        T_QUEUE_ELEMENTS* front()
+        {
+            if ( empty() )
+                return nullptr;
+            return &(buffer[(queue_tail + 1U) % QUEUE_SIZE]);
+        }
+
+        t_overflow push(T_QUEUE_ELEMENTS element)
+        {
+            if ( num_elements_stored >= QUEUE_SIZE )
+            {
+                buffer_overflow = true;
+                queue_tail = (queue_tail + 1U) % QUEUE_SIZE;
+            }
+            else
+                num_elements_stored = num_elements_stored + 1U;
+            queue_head = (queue_head + 1U) % QUEUE_SIZE;
+            buffer[queue_head] = element;
+            return ( buffer_overflow ) ? BUFFER_OVERFLOW : BUFFER_OK;
+        }
+
+        void pop()
+        {
+            if ( empty() )
+                return;
+            queue_tail = (queue_tail + 1U) % QUEUE_SIZE;
+            num_elements_stored = num_elements_stored - 1U;
+            buffer_overflow = false;
+        }
+
+    private:
+
+        T_QUEUE_ELEMENTS buffer[QUEUE_SIZE];
+        uint32_t queue_head;
+        uint32_t queue_tail;
+        uint32_t num_elements_stored;
+        bool buffer_overflow;
+};
+
+/*****************************************************************************/
+
+/* Benchmark Cases */
+
+/**
+ * @brief Push to a random Queue, and pop from it when it has more than half
+ * of its capacity.
+ * @return double Nanoseconds per event.
+ */
+template <typename T_QUEUE, typename T_ELEMENT, uint32_t QUEUE_SIZE>
+static double run(T_QUEUE* queues)
+{
+    return sbench_measure(
+        [&]()
+        {
+            uint32_t state = 12345U;
+            uint32_t check = 0U;
+
+            for ( uint32_t i = 0U; i < EVENTS; i++ )
+            {
+                T_QUEUE& queue = queues[(state >> 8) % NUM_QUEUES];
+
+                state = (state * 1664525U) + 1013904223U;
+                queue.push(static_cast<T_ELEMENT>(i));
+                if ( queue.size() > (QUEUE_SIZE / 2U) )
+                {
+                    check = check + *(queue.front());
+                    queue.pop();
+                }
+            }
+            SBENCH_KEEP(check);
+        }, EVENTS);
+}
+
+template <typename T_ELEMENT, uint32_t QUEUE_SIZE>
+static void run_size(const char* title)
+{
+    typedef SQueue<T_ELEMENT, QUEUE_SIZE> t_queue;
+    typedef t_legacy_queue<T_ELEMENT, QUEUE_SIZE> t_legacy;
+    static t_queue queues[NUM_QUEUES];
+    static t_legacy legacy[NUM_QUEUES];
+
+    std::printf("\n%s, %u Queues: %.1f KB now, %.1f KB before "
+            "(ns per event)\n", title, static_cast<unsigned>(NUM_QUEUES),
+            sizeof(queues) / 1024.0, sizeof(legacy) / 1024.0);
+    sbench_report("SQueue (compact indexes)",
+            run<t_queue, T_ELEMENT, QUEUE_SIZE>(queues));
+    sbench_report("Previous layout (32 bits indexes)",
+            run<t_legacy, T_ELEMENT, QUEUE_SIZE>(legacy));
+}
+
+/*****************************************************************************/
+
+/* Main Function */
+
+int main()
+{
+    sbench_title("sizeof of the Queue (bytes)");
+    std::printf("%-32s %8s %8s\n", "Queue", "before", "now");
+    std::printf("%-32s %8u %8u\n", "SQueue<uint8_t, 8>",
+            static_cast<unsigned>(sizeof(t_legacy_queue<uint8_t, 8>)),
+            static_cast<unsigned>(sizeof(SQueue<uint8_t, 8>)));
+    std::printf("%-32s %8u %8u\n", "SQueue<uint8_t, 16>",
+            static_cast<unsigned>(sizeof(t_legacy_queue<uint8_t, 16>)),
+            static_cast<unsigned>(sizeof(SQueue<uint8_t, 16>)));
+    std::printf("%-32s %8u %8u\n", "SQueue<uint32_t, 16>",
+            static_cast<unsigned>(sizeof(t_legacy_queue<uint32_t, 16>)),
+            static_cast<unsigned>(sizeof(SQueue<uint32_t, 16>)));
+    std::printf("%-32s %8u %8u\n", "SQueue<uint8_t, 1024>",
+            static_cast<unsigned>(sizeof(t_legacy_queue<uint8_t, 1024>)),
+            static_cast<unsigned>(sizeof(SQueue<uint8_t, 1024>)));
+
+    run_size<uint8_t, 8U>("SQueue<uint8_t, 8>");
+    run_size<uint32_t, 16U>("SQueue<uint32_t, 16>");
+
+    return 0;
+}
+
+/*****************************************************************************/
@@ -0,0 +1,295 @@
+/**
+ * @file    bench_drrqueue.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    17-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * SDrrQueue fairness and dequeue throughput with 64 lanes kept backlogged
+ * (each dequeued message is pushed again to its lane). With weights in
+ * elements (1, 2, 4 and 8, 16 lanes each) it shows the share of the
+ * dequeues served per weight against the expected one, and with weights
+ * in bytes (the same weight for lanes with messages of 64 to 1500 bytes)
+ * the share of the served bytes. The time per dequeue (a pop and a push)
+ * is compared with a single SQueue FIFO.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2022 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ libraries
+#include <cstdint>
+#include <cstdio>
+
+// Static Queue
+#include "sdrrqueue.hpp"
+#include "squeue.hpp"
+
+// Benchmark helpers
+#include "sbench.hpp"
+
+/*****************************************************************************/
+
+/* Benchmark Configuration */
+
+static const uint32_t NUM_LANES = 64U;
+
+static const uint32_t LANE_SIZE = 256U;
+
+/**
+ * @brief Number of weight classes (the lane i has the class i % 4).
+ */
+static const uint32_t NUM_CLASSES = 4U;
+
+/**
+ * @brief Number of dequeues on each measure.
+ */
+static const uint32_t OPS = 1048576U;
+
+/*****************************************************************************/
+
+/* Benchmark Data Types */
+
+struct t_message
+{
+    uint32_t lane;
+    uint32_t size;
+    uint64_t payload;
+};
+
+/**
+ * @brief Cost function for weights in bytes.
+ */
+struct t_bytes_cost
+{
+    uint32_t operator()(const t_message& message) const
+    {
+        return message.size;
+    }
+};
+
+typedef SDrrQueue<t_message, LANE_SIZE, NUM_LANES> t_drr;
+
+typedef SDrrQueue<t_message, LANE_SIZE, NUM_LANES, t_bytes_cost>
+        t_drr_bytes;
+
+/*****************************************************************************/
+
+/* Benchmark Helpers */
+
+/**
+ * @brief Weight in elements of each lane class.
+ */
+static uint32_t class_weight(uint32_t weight_class)
+{
+    return 1U << weight_class;
+}
+
+/**
+ * @brief Message size in bytes of each lane class.
+ */
+static uint32_t class_size(uint32_t weight_class)
+{
+    const uint32_t sizes[NUM_CLASSES] = { 64U, 256U, 512U, 1500U };
+
+    return sizes[weight_class];
+}
+
+/**
+ * @brief Fill all the lanes of a DRR Queue.
+ */
+template <typename T_DRR>
+static void fill(T_DRR& queue)
+{
+    queue.clear();
+    for ( uint32_t i = 0U; i < LANE_SIZE; i++ )
+    {
+        for ( uint32_t lane = 0U; lane < NUM_LANES; lane++ )
+        {
+            queue.push(lane, t_message{ lane,
+                    class_size(lane % NUM_CLASSES), i });
+        }
+    }
+}
+
+/**
+ * @brief Dequeue messages from a backlogged DRR Queue, pushing each one
+ * again to its lane.
+ */
+template <typename T_DRR>
+static void serve(T_DRR& queue, uint32_t count)
+{
+    uint64_t check = 0U;
+
+    for ( uint32_t i = 0U; i < count; i++ )
+    {
+        t_message message = *(queue.front());
+
+        queue.pop();
+        check = check + message.payload;
+        message.payload = message.payload + 1U;
+        queue.push(message.lane, message);
+    }
+    SBENCH_KEEP(check);
+}
+
+/*****************************************************************************/
+
+/* Benchmark Cases */
+
+/**
+ * @brief Served share per lane class against the expected share.
+ */
+template <typename T_DRR>
+static void report_shares(const T_DRR& queue, bool bytes)
+{
+    double served[NUM_CLASSES] = { 0.0 };
+    double expected[NUM_CLASSES] = { 0.0 };
+    double served_total = 0.0;
+    double expected_total = 0.0;
+
+    for ( uint32_t lane = 0U; lane < NUM_LANES; lane++ )
+    {
+        uint32_t c = lane % NUM_CLASSES;
+        double value = bytes ?
+                static_cast<double>(queue.served_cost(lane)) :
+                static_cast<double>(queue.served_count(lane));
+        double weight = bytes ? 1.0 : static_cast<double>(class_weight(c));
+
+        served[c] = served[c] + value;
+        served_total = served_total + value;
+        expected[c] = expected[c] + weight;
+        expected_total = expected_total + weight;
+    }
+
+    std::printf("%-24s %12s %12s\n", bytes ? "lanes (message size)" :
+            "lanes (weight)", "expected %", "served %");
+    for ( uint32_t c = 0U; c < NUM_CLASSES; c++ )
+    {
+        std::printf("%2u lanes of %-11u %12.2f %12.2f\n",
+                static_cast<unsigned>(NUM_LANES / NUM_CLASSES),
+                static_cast<unsigned>(bytes ? class_size(c) :
+                        class_weight(c)),
+                (100.0 * expected[c]) / expected_total,
+                (100.0 * served[c]) / served_total);
+    }
+}
+
+static void run_fairness()
+{
+    static t_drr queue;
+    static t_drr_bytes queue_bytes;
+
+    std::printf("\nWeights in elements, %u dequeues\n",
+            static_cast<unsigned>(OPS));
+    for ( uint32_t lane = 0U; lane < NUM_LANES; lane++ )
+        queue.set_weight(lane, class_weight(lane % NUM_CLASSES));
+    fill(queue);
+    serve(queue, OPS);
+    report_shares(queue, false);
+
+    std::printf("\nWeights in bytes (1500 per lane), %u dequeues\n",
+            static_cast<unsigned>(OPS));
+    for ( uint32_t lane = 0U; lane < NUM_LANES; lane++ )
+        queue_bytes.set_weight(lane, 1500U);
+    fill(queue_bytes);
+    serve(queue_bytes, OPS);
+    report_shares(queue_bytes, true);
+}
+
+static void run_throughput()
+{
+    static t_drr queue;
+    static t_drr_bytes queue_bytes;
+    static SQueue<t_message, NUM_LANES * LANE_SIZE> fifo;
+    double ns;
+
+    sbench_title("64 backlogged lanes (ns per dequeue and push)");
+
+    ns = sbench_measure(
+        [&]()
+        {
+            for ( uint32_t lane = 0U; lane < NUM_LANES; lane++ )
+                queue.set_weight(lane, class_weight(lane % NUM_CLASSES));
+            fill(queue);
+        },
+        [&]()
+        {
+            serve(queue, OPS);
+        }, OPS);
+    sbench_report("SDrrQueue, weights in elements", ns);
+
+    ns = sbench_measure(
+        [&]()
+        {
+            for ( uint32_t lane = 0U; lane < NUM_LANES; lane++ )
+                queue_bytes.set_weight(lane, 1500U);
+            fill(queue_bytes);
+        },
+        [&]()
+        {
+            serve(queue_bytes, OPS);
+        }, OPS);
+    sbench_report("SDrrQueue, weights in bytes", ns);
+
+    ns = sbench_measure(
+        [&]()
+        {
+            fifo.clear();
+            for ( uint32_t i = 0U; i < (NUM_LANES * LANE_SIZE); i++ )
+            {
+                fifo.push(t_message{ i % NUM_LANES,
+                        class_size(i % NUM_CLASSES), i });
+            }
+        },
+        [&]()
+        {
+            uint64_t check = 0U;
+
+            for ( uint32_t i = 0U; i < OPS; i++ )
+            {
+                t_message message = *(fifo.front());
+
+                fifo.pop();
+                check = check + message.payload;
+                message.payload = message.payload + 1U;
+                fifo.push(message);
+            }
+            SBENCH_KEEP(check);
+        }, OPS);
+    sbench_report("SQueue FIFO (no fairness)", ns);
+}
+
+/*****************************************************************************/
+
+/* Main Function */
+
+int main()
+{
+    run_throughput();
+    run_fairness();
+
+    return 0;
+}
+
+/*****************************************************************************/
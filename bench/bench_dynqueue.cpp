@@ -0,0 +1,148 @@
+/**
+ * @file    bench_dynqueue.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    17-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * SDynQueue (capacity set at construction, from a runtime value) against
+ * a compile time size SQueue of the same capacity: push and pop in
+ * batches, and a scan of the elements with operator[].
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2022 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ libraries
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+
+// Static Queue
+#include "sheapstorage.hpp"
+#include "squeue.hpp"
+
+// Benchmark helpers
+#include "sbench.hpp"
+
+/*****************************************************************************/
+
+/* Benchmark Configuration */
+
+static const uint64_t QUEUE_SIZE = 4096U;
+
+static const uint32_t BATCH = 64U;
+
+/**
+ * @brief Number of batches on each measure.
+ */
+static const uint32_t BATCHES = 65536U;
+
+/**
+ * @brief Number of full scans on each measure.
+ */
+static const uint32_t SCANS = 1024U;
+
+/*****************************************************************************/
+
+/* Benchmark Cases */
+
+template <typename T_QUEUE>
+static void run(const char* name, T_QUEUE& queue)
+{
+    char label[64];
+    double ns;
+
+    // Half full, so the batches wrap around the buffer end
+    queue.clear();
+    for ( uint32_t i = 0U; i < (queue.capacity() / 2U); i++ )
+        queue.push(i);
+
+    ns = sbench_measure(
+        [&]()
+        {
+            uint32_t check = 0U;
+
+            for ( uint32_t b = 0U; b < BATCHES; b++ )
+            {
+                for ( uint32_t i = 0U; i < BATCH; i++ )
+                    queue.push(b + i);
+                for ( uint32_t i = 0U; i < BATCH; i++ )
+                {
+                    check = check + *(queue.front());
+                    queue.pop();
+                }
+            }
+            SBENCH_KEEP(check);
+        }, BATCHES * BATCH);
+    std::snprintf(label, sizeof(label), "%s push()/pop()", name);
+    sbench_report(label, ns);
+
+    ns = sbench_measure(
+        [&]()
+        {
+            for ( uint32_t s = 0U; s < SCANS; s++ )
+            {
+                uint32_t sum = 0U;
+                for ( typename T_QUEUE::size_type i = 0U; i < queue.size();
+                      i++ )
+                    sum = sum + queue[i];
+                SBENCH_KEEP(sum);
+            }
+        }, SCANS * queue.size());
+    std::snprintf(label, sizeof(label), "%s operator[] scan", name);
+    sbench_report(label, ns);
+}
+
+/*****************************************************************************/
+
+/* Main Function */
+
+int main(int argc, char** argv)
+{
+    static SQueue<uint32_t, QUEUE_SIZE> fixed;
+    // Capacity from the command line, as it would come from a config file
+    size_t capacity = ( argc > 1 ) ?
+            static_cast<size_t>(std::strtoul(argv[1], nullptr, 10)) : 3000U;
+    SDynQueue<uint32_t> dynamic(capacity);
+
+    if ( !dynamic.storage().valid() || (dynamic.capacity() < (2U * BATCH)) )
+    {
+        std::printf("Invalid runtime capacity %lu\n",
+                static_cast<unsigned long>(capacity));
+        return 1;
+    }
+
+    std::printf("\nSQueue<uint32_t, %lu> and SDynQueue<uint32_t>(%lu) with "
+            "capacity %lu (ns per element)\n",
+            static_cast<unsigned long>(QUEUE_SIZE),
+            static_cast<unsigned long>(capacity),
+            static_cast<unsigned long>(dynamic.capacity()));
+
+    run("SQueue", fixed);
+    run("SDynQueue", dynamic);
+
+    return 0;
+}
+
+/*****************************************************************************/
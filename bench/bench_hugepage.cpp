@@ -0,0 +1,272 @@
+/**
+ * @file    bench_hugepage.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    17-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * SQueueHugePageStorage against the plain array storage (regular 4 KB
+ * pages) for a Queue of 64M elements of 8 bytes (512 MB): dependent random
+ * position reads (each position depends on the previous read, so the
+ * reads are not overlapped) and a sequential scan. The data TLB misses are
+ * counted with perf_event_open() when the system allows it (otherwise
+ * they are shown as not available and only the time is measured).
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2022 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ libraries
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+// Linux libraries
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+// Static Queue
+#include "shugepagestorage.hpp"
+#include "squeue.hpp"
+
+// Benchmark helpers
+#include "sbench.hpp"
+
+/*****************************************************************************/
+
+/* Benchmark Configuration */
+
+static const uint64_t QUEUE_SIZE = 67108864U;
+
+/**
+ * @brief Number of random position reads on each measure.
+ */
+static const uint64_t READS = 1048576U;
+
+/*****************************************************************************/
+
+/* Benchmark Data */
+
+typedef SQueue<uint64_t, QUEUE_SIZE> t_plain_queue;
+
+typedef SQueue<uint64_t, QUEUE_SIZE, SQueueHugePageStorage> t_huge_queue;
+
+static t_plain_queue plain_queue;
+
+/*****************************************************************************/
+
+/* Data TLB Misses Counter */
+
+/**
+ * @brief Data TLB read misses counter of this process (user space only).
+ */
+class t_dtlb_counter
+{
+    public:
+
+        t_dtlb_counter()
+        {
+            struct perf_event_attr attr;
+
+            std::memset(&attr, 0, sizeof(attr));
+            attr.size = sizeof(attr);
+            attr.type = PERF_TYPE_HW_CACHE;
+            attr.config = PERF_COUNT_HW_CACHE_DTLB |
+                    (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                    (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+            attr.disabled = 1;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            fd = static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1,
+                    -1, 0));
+        }
+
+        ~t_dtlb_counter()
+        {
+            if ( fd >= 0 )
+                close(fd);
+        }
+
+        bool available() const
+        {
+            return ( fd >= 0 );
+        }
+
+        void start()
+        {
+            if ( fd < 0 )
+                return;
+            ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+            ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+        }
+
+        uint64_t stop()
+        {
+            uint64_t count = 0U;
+
+            if ( fd < 0 )
+                return 0U;
+            ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+            if ( read(fd, &count, sizeof(count)) !=
+                 static_cast<ssize_t>(sizeof(count)) )
+                return 0U;
+            return count;
+        }
+
+    private:
+
+        int fd;
+};
+
+/*****************************************************************************/
+
+/* Benchmark Helpers */
+
+/**
+ * @brief Get the transparent huge pages of this process, in KB.
+ */
+static unsigned long anon_huge_kb()
+{
+    unsigned long kb = 0U;
+    char line[256];
+    FILE* file = std::fopen("/proc/self/smaps_rollup", "r");
+
+    if ( file == nullptr )
+        return 0U;
+    while ( std::fgets(line, sizeof(line), file) != nullptr )
+    {
+        if ( std::sscanf(line, "AnonHugePages: %lu kB", &kb) == 1 )
+            break;
+    }
+    std::fclose(file);
+
+    return kb;
+}
+
+/**
+ * @brief Print a case result with its data TLB misses per operation.
+ */
+static void report(const char* name, double ns, t_dtlb_counter& counter,
+        uint64_t misses, uint64_t ops)
+{
+    sbench_report(name, ns);
+    if ( counter.available() )
+        std::printf("%-48s %10.3f dTLB misses/op\n", "",
+                static_cast<double>(misses) / static_cast<double>(ops));
+    else
+        std::printf("%-48s %10s dTLB misses/op\n", "", "n/a");
+}
+
+/**
+ * @brief Fill a Queue and measure its random reads and sequential scan.
+ */
+template <typename T_QUEUE>
+static void run(const char* name, T_QUEUE& queue, t_dtlb_counter& counter)
+{
+    char label[64];
+    uint64_t misses = 0U;
+    double ns;
+
+    for ( uint64_t i = 0U; i < QUEUE_SIZE; i++ )
+        queue.push(i);
+
+    auto random_reads = [&]()
+    {
+        uint64_t position = 0U;
+
+        // Each read position depends on the previous read value
+        for ( uint64_t i = 0U; i < READS; i++ )
+        {
+            position = (position * 6364136223846793005ULL) +
+                    queue[position] + 1442695040888963407ULL;
+            position = (position >> 24) % QUEUE_SIZE;
+        }
+        SBENCH_KEEP(position);
+    };
+    auto scan = [&]()
+    {
+        uint64_t sum = 0U;
+
+        queue.for_each_segment(
+            [&](const uint64_t* data, uint64_t n)
+            {
+                for ( uint64_t i = 0U; i < n; i++ )
+                    sum = sum + data[i];
+            });
+        SBENCH_KEEP(sum);
+    };
+
+    ns = sbench_measure(random_reads, READS);
+    counter.start();
+    random_reads();
+    misses = counter.stop();
+    std::snprintf(label, sizeof(label), "%s random reads", name);
+    report(label, ns, counter, misses, READS);
+
+    ns = sbench_measure(scan, QUEUE_SIZE);
+    counter.start();
+    scan();
+    misses = counter.stop();
+    std::snprintf(label, sizeof(label), "%s sequential scan", name);
+    report(label, ns, counter, misses, QUEUE_SIZE);
+}
+
+/*****************************************************************************/
+
+/* Main Function */
+
+int main()
+{
+    t_dtlb_counter counter;
+    unsigned long huge_before = anon_huge_kb();
+    t_huge_queue* huge_queue = new t_huge_queue();
+    unsigned long huge_after = anon_huge_kb();
+
+    if ( !huge_queue->storage().valid() )
+    {
+        std::printf("Can not map the huge page storage\n");
+        delete huge_queue;
+        return 1;
+    }
+
+    std::printf("\nQueue of %llu elements of 8 bytes (ns per element)\n",
+            static_cast<unsigned long long>(QUEUE_SIZE));
+    if ( huge_queue->storage().huge_pages() )
+        std::printf("Huge page storage: MAP_HUGETLB\n");
+    else
+        std::printf("Huge page storage: MADV_HUGEPAGE, %lu KB in "
+                "transparent huge pages\n", huge_after - huge_before);
+    if ( !counter.available() )
+        std::printf("dTLB misses: perf_event_open() not available\n");
+
+    run("Array storage", plain_queue, counter);
+    run("Huge page storage", *huge_queue, counter);
+
+    delete huge_queue;
+
+    return 0;
+}
+
+/*****************************************************************************/
@@ -0,0 +1,214 @@
+/**
+ * @file    bench_intrusivequeue.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    17-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Long-lived objects (64 and 512 bytes, picked at random from 4096
+ * objects) passed through a Queue in batches of 16: linked into a
+ * SIntrusiveQueue or a SIntrusiveMpscQueue (single thread use) against
+ * copied into a SQueue of objects, with a SQueue of object pointers as
+ * reference.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2022 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ libraries
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+// Static Queue
+#include "sintrusivequeue.hpp"
+#include "squeue.hpp"
+
+// Benchmark helpers
+#include "sbench.hpp"
+
+/*****************************************************************************/
+
+/* Benchmark Configuration */
+
+static const uint32_t NUM_OBJECTS = 4096U;
+
+static const uint32_t BATCH = 16U;
+
+/**
+ * @brief Number of batches on each measure.
+ */
+static const uint32_t BATCHES = 16384U;
+
+/*****************************************************************************/
+
+/* Benchmark Data Types */
+
+template <typename T_HOOK, size_t OBJECT_SIZE>
+struct t_object : public T_HOOK
+{
+    uint64_t id;
+    uint8_t state[OBJECT_SIZE - sizeof(T_HOOK) - sizeof(uint64_t)];
+};
+
+/*****************************************************************************/
+
+/* Benchmark Helpers */
+
+/**
+ * @brief Random object index generator (the same sequence for each case).
+ * An object can only be linked once, so the objects of a batch are taken
+ * from different slices of the objects array.
+ */
+struct t_picker
+{
+    uint32_t state = 12345U;
+
+    uint32_t next(uint32_t i)
+    {
+        const uint32_t slice = NUM_OBJECTS / BATCH;
+
+        state = (state * 1664525U) + 1013904223U;
+        return ((state >> 8) % slice) + (i * slice);
+    }
+};
+
+/*****************************************************************************/
+
+/* Benchmark Cases */
+
+template <size_t OBJECT_SIZE>
+static void run()
+{
+    typedef t_object<SQueueHook, OBJECT_SIZE> t_st_object;
+    typedef t_object<SMpscQueueHook, OBJECT_SIZE> t_mpsc_object;
+    static t_st_object st_objects[NUM_OBJECTS];
+    static t_mpsc_object mpsc_objects[NUM_OBJECTS];
+    static SIntrusiveQueue<t_st_object> intrusive;
+    static SIntrusiveMpscQueue<t_mpsc_object> mpsc;
+    static SQueue<t_st_object, 2U * BATCH> copies;
+    static SQueue<t_st_object*, 2U * BATCH> pointers;
+    double ns;
+
+    for ( uint32_t i = 0U; i < NUM_OBJECTS; i++ )
+    {
+        st_objects[i].id = i;
+        std::memset(st_objects[i].state, 0, sizeof(st_objects[i].state));
+        mpsc_objects[i].id = i;
+        std::memset(mpsc_objects[i].state, 0, sizeof(mpsc_objects[i].state));
+    }
+
+    std::printf("\nObjects of %u bytes (ns per object)\n",
+            static_cast<unsigned>(sizeof(t_st_object)));
+
+    ns = sbench_measure(
+        [&]()
+        {
+            t_picker picker;
+            uint64_t check = 0U;
+
+            for ( uint32_t b = 0U; b < BATCHES; b++ )
+            {
+                for ( uint32_t i = 0U; i < BATCH; i++ )
+                    intrusive.push(&(st_objects[picker.next(i)]));
+                for ( uint32_t i = 0U; i < BATCH; i++ )
+                {
+                    check = check + intrusive.front()->id;
+                    intrusive.pop();
+                }
+            }
+            SBENCH_KEEP(check);
+        }, BATCHES * BATCH);
+    sbench_report("SIntrusiveQueue link", ns);
+
+    ns = sbench_measure(
+        [&]()
+        {
+            t_picker picker;
+            uint64_t check = 0U;
+
+            for ( uint32_t b = 0U; b < BATCHES; b++ )
+            {
+                for ( uint32_t i = 0U; i < BATCH; i++ )
+                    mpsc.push(&(mpsc_objects[picker.next(i)]));
+                for ( uint32_t i = 0U; i < BATCH; i++ )
+                    check = check + mpsc.pop()->id;
+            }
+            SBENCH_KEEP(check);
+        }, BATCHES * BATCH);
+    sbench_report("SIntrusiveMpscQueue link", ns);
+
+    ns = sbench_measure(
+        [&]()
+        {
+            t_picker picker;
+            uint64_t check = 0U;
+
+            for ( uint32_t b = 0U; b < BATCHES; b++ )
+            {
+                for ( uint32_t i = 0U; i < BATCH; i++ )
+                    copies.push(st_objects[picker.next(i)]);
+                for ( uint32_t i = 0U; i < BATCH; i++ )
+                {
+                    check = check + copies.front()->id;
+                    copies.pop();
+                }
+            }
+            SBENCH_KEEP(check);
+        }, BATCHES * BATCH);
+    sbench_report("SQueue copy", ns);
+
+    ns = sbench_measure(
+        [&]()
+        {
+            t_picker picker;
+            uint64_t check = 0U;
+
+            for ( uint32_t b = 0U; b < BATCHES; b++ )
+            {
+                for ( uint32_t i = 0U; i < BATCH; i++ )
+                    pointers.push(&(st_objects[picker.next(i)]));
+                for ( uint32_t i = 0U; i < BATCH; i++ )
+                {
+                    check = check + (*(pointers.front()))->id;
+                    pointers.pop();
+                }
+            }
+            SBENCH_KEEP(check);
+        }, BATCHES * BATCH);
+    sbench_report("SQueue of pointers (reference)", ns);
+}
+
+/*****************************************************************************/
+
+/* Main Function */
+
+int main()
+{
+    run<64U>();
+    run<512U>();
+
+    return 0;
+}
+
+/*****************************************************************************/
@@ -0,0 +1,186 @@
+/**
+ * @file    bench_journalqueue.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    17-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Cost of the SJournalQueue durability levels: batches of 16 messages of
+ * 64 bytes pushed and committed, and then popped and committed, with no
+ * flush, a periodic msync() and an msync() per batch, and a plain SQueue as
+ * reference. The Queue file is created in /tmp, or in the directory given
+ * as first argument (the flush cost depends on the file system).
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2022 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ libraries
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+// POSIX libraries
+#include <unistd.h>
+
+// Static Queue
+#include "squeue.hpp"
+#include "sjournalqueue.hpp"
+
+// Benchmark helpers
+#include "sbench.hpp"
+
+/*****************************************************************************/
+
+/* Benchmark Configuration */
+
+static const uint32_t QUEUE_SIZE = 4096U;
+
+static const uint32_t BATCH = 16U;
+
+/**
+ * @brief Number of batches on each measure.
+ */
+static const uint32_t BATCHES = 1024U;
+
+/*****************************************************************************/
+
+/* Benchmark Data Types */
+
+struct t_record
+{
+    uint64_t sequence;
+    uint8_t payload[56];
+};
+
+typedef SJournalQueue<t_record, QUEUE_SIZE> t_journal;
+
+/*****************************************************************************/
+
+/* Benchmark Cases */
+
+/**
+ * @brief Push, commit, pop and commit the batches with a durability level.
+ * @return double Nanoseconds per message (0 if the file can not be opened).
+ */
+static double run_journal(const char* path, t_journal_sync sync)
+{
+    static t_journal journal;
+    t_record record;
+    double ns;
+
+    unlink(path);
+    if ( !journal.open(path, sync, 64U) )
+        return 0.0;
+
+    std::memset(&record, 0x5A, sizeof(record));
+    ns = sbench_measure(
+        [&]()
+        {
+            for ( uint32_t b = 0U; b < BATCHES; b++ )
+            {
+                for ( uint32_t i = 0U; i < BATCH; i++ )
+                {
+                    record.sequence = (b * BATCH) + i;
+                    journal.push(record);
+                }
+                journal.commit();
+
+                for ( uint32_t i = 0U; i < BATCH; i++ )
+                {
+                    SBENCH_KEEP(journal.front()->sequence);
+                    journal.pop();
+                }
+                journal.commit();
+            }
+        }, BATCHES * BATCH);
+
+    journal.close();
+    unlink(path);
+
+    return ns;
+}
+
+/**
+ * @brief Push and pop the batches with a plain SQueue.
+ * @return double Nanoseconds per message.
+ */
+static double run_squeue()
+{
+    static SQueue<t_record, QUEUE_SIZE> queue;
+    t_record record;
+
+    std::memset(&record, 0x5A, sizeof(record));
+    return sbench_measure(
+        [&]()
+        {
+            for ( uint32_t b = 0U; b < BATCHES; b++ )
+            {
+                for ( uint32_t i = 0U; i < BATCH; i++ )
+                {
+                    record.sequence = (b * BATCH) + i;
+                    queue.push(record);
+                }
+                for ( uint32_t i = 0U; i < BATCH; i++ )
+                {
+                    SBENCH_KEEP(queue.front()->sequence);
+                    queue.pop();
+                }
+            }
+        }, BATCHES * BATCH);
+}
+
+/*****************************************************************************/
+
+/* Main Function */
+
+int main(int argc, char** argv)
+{
+    const char* dir = ( argc > 1 ) ? argv[1] : "/tmp";
+    char path[256];
+    double ns;
+
+    std::snprintf(path, sizeof(path), "%s/squeue_bench_journal_%d", dir,
+            static_cast<int>(getpid()));
+
+    std::printf("\nJournal in %s, batches of %u messages of 64 bytes "
+            "(ns per message)\n", dir, static_cast<unsigned>(BATCH));
+
+    sbench_report("SQueue (no persistence)", run_squeue());
+
+    ns = run_journal(path, JOURNAL_SYNC_NONE);
+    if ( ns == 0.0 )
+    {
+        std::printf("Can not open %s\n", path);
+        return 1;
+    }
+    sbench_report("JOURNAL_SYNC_NONE", ns);
+    sbench_report("JOURNAL_SYNC_PERIODIC (every 64 commits)",
+            run_journal(path, JOURNAL_SYNC_PERIODIC));
+    sbench_report("JOURNAL_SYNC_BATCH (every commit)",
+            run_journal(path, JOURNAL_SYNC_BATCH));
+
+    return 0;
+}
+
+/*****************************************************************************/
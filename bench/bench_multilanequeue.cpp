@@ -0,0 +1,270 @@
+/**
+ * @file    bench_multilanequeue.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    17-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * SMultiLaneQueue with 8 priority lanes against binary heaps
+ * (SPriorityQueue with arity 2 and std::priority_queue) ordered by
+ * priority class and then by arrival, for a traffic of 8 classes with most
+ * of the messages in the low priority classes: a hold workload (a pop and
+ * a push on a Queue that keeps 1024 messages) and bursts of 64 pushes
+ * followed by 64 pops. It also shows the per lane overflow counters of a
+ * burst pushed to lanes of 16 to 128 elements, sized per class.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2022 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ libraries
+#include <cstdint>
+#include <cstdio>
+#include <queue>
+#include <vector>
+
+// Static Queue
+#include "smultilanequeue.hpp"
+#include "spriorityqueue.hpp"
+
+// Benchmark helpers
+#include "sbench.hpp"
+
+/*****************************************************************************/
+
+/* Benchmark Configuration */
+
+static const uint32_t NUM_CLASSES = 8U;
+
+static const uint32_t LANE_SIZE = 4096U;
+
+static const uint32_t HOLD_SIZE = 1024U;
+
+static const uint32_t BURST = 64U;
+
+/**
+ * @brief Messages pushed, without pops, to the small lanes Queue.
+ */
+static const uint32_t OVERFLOW_BURST = 512U;
+
+/**
+ * @brief Number of operations on each measure.
+ */
+static const uint32_t OPS = 1048576U;
+
+/*****************************************************************************/
+
+/* Benchmark Data Types */
+
+struct t_message
+{
+    uint32_t priority_class;
+    uint32_t sequence;
+    uint64_t payload;
+};
+
+/**
+ * @brief Heap order: lower class number first, and arrival order inside a
+ * class (as the lanes of SMultiLaneQueue).
+ */
+struct t_lower_priority
+{
+    bool operator()(const t_message& a, const t_message& b) const
+    {
+        if ( a.priority_class != b.priority_class )
+            return ( a.priority_class > b.priority_class );
+        return ( a.sequence > b.sequence );
+    }
+};
+
+typedef SMultiLaneQueue<t_message, LANE_SIZE, LANE_SIZE, LANE_SIZE,
+        LANE_SIZE, LANE_SIZE, LANE_SIZE, LANE_SIZE, LANE_SIZE> t_lanes;
+
+/**
+ * @brief Lanes sized per class, larger for the more frequent classes.
+ */
+typedef SMultiLaneQueue<t_message, 16U, 16U, 32U, 32U, 64U, 64U, 128U,
+        128U> t_small_lanes;
+
+typedef SPriorityQueue<t_message, NUM_CLASSES * LANE_SIZE, t_lower_priority,
+        PRIORITY_REJECT, 2U> t_heap;
+
+typedef std::priority_queue<t_message, std::vector<t_message>,
+        t_lower_priority> t_std_heap;
+
+/*****************************************************************************/
+
+/* Benchmark Helpers */
+
+/**
+ * @brief Messages generator: class 0 (control) is rare, and each lower
+ * priority class is about twice as frequent as the previous one.
+ */
+struct t_traffic
+{
+    uint32_t state = 12345U;
+    uint32_t sequence = 0U;
+
+    t_message next()
+    {
+        uint32_t r, priority_class = NUM_CLASSES - 1U;
+
+        state = (state * 1664525U) + 1013904223U;
+        r = (state >> 16) & 0xFFU;
+        while ( (priority_class > 0U) && ((r & 1U) != 0U) )
+        {
+            priority_class = priority_class - 1U;
+            r = r >> 1;
+        }
+        sequence = sequence + 1U;
+
+        return t_message{ priority_class, sequence, state };
+    }
+};
+
+/**
+ * @brief Adapters of the three Queues to the same interface.
+ */
+static void push(t_lanes& q, const t_message& m) { q.push(m.priority_class, m); }
+static void push(t_heap& q, const t_message& m) { q.push(m); }
+static void push(t_std_heap& q, const t_message& m) { q.push(m); }
+
+static const t_message& top(t_lanes& q) { return *(q.front()); }
+static const t_message& top(t_heap& q) { return *(q.top()); }
+static const t_message& top(t_std_heap& q) { return q.top(); }
+
+/*****************************************************************************/
+
+/* Benchmark Cases */
+
+template <typename T_QUEUE>
+static void run(const char* name, T_QUEUE& queue)
+{
+    t_traffic traffic;
+    char label[64];
+    double ns;
+
+    ns = sbench_measure(
+        [&]()
+        {
+            traffic = t_traffic();
+            while ( !queue.empty() )
+                queue.pop();
+            for ( uint32_t i = 0U; i < HOLD_SIZE; i++ )
+                push(queue, traffic.next());
+        },
+        [&]()
+        {
+            uint64_t check = 0U;
+
+            for ( uint32_t i = 0U; i < OPS; i++ )
+            {
+                check = check + top(queue).payload;
+                queue.pop();
+                push(queue, traffic.next());
+            }
+            SBENCH_KEEP(check);
+        }, OPS);
+    std::snprintf(label, sizeof(label), "%s hold", name);
+    sbench_report(label, ns);
+
+    ns = sbench_measure(
+        [&]()
+        {
+            traffic = t_traffic();
+            while ( !queue.empty() )
+                queue.pop();
+        },
+        [&]()
+        {
+            uint64_t check = 0U;
+
+            for ( uint32_t b = 0U; b < (OPS / BURST); b++ )
+            {
+                for ( uint32_t i = 0U; i < BURST; i++ )
+                    push(queue, traffic.next());
+                for ( uint32_t i = 0U; i < BURST; i++ )
+                {
+                    check = check + top(queue).payload;
+                    queue.pop();
+                }
+            }
+            SBENCH_KEEP(check);
+        }, OPS);
+    std::snprintf(label, sizeof(label), "%s bursts", name);
+    sbench_report(label, ns);
+}
+
+/**
+ * @brief Per lane overflows of a burst pushed to lanes smaller than it.
+ */
+static void run_overflow()
+{
+    static t_small_lanes lanes;
+    t_traffic traffic;
+    uint32_t pushed[NUM_CLASSES] = { 0U };
+
+    for ( uint32_t i = 0U; i < OVERFLOW_BURST; i++ )
+    {
+        t_message message = traffic.next();
+
+        pushed[message.priority_class] = pushed[message.priority_class] + 1U;
+        lanes.push(message.priority_class, message);
+    }
+
+    std::printf("\nBurst of %u messages to lanes of 16 to 128 elements\n",
+            static_cast<unsigned>(OVERFLOW_BURST));
+    std::printf("%-8s %10s %10s %10s %10s\n", "lane", "capacity", "pushed",
+            "queued", "overflows");
+    for ( uint32_t i = 0U; i < NUM_CLASSES; i++ )
+    {
+        std::printf("%-8u %10u %10u %10u %10u\n", static_cast<unsigned>(i),
+                static_cast<unsigned>(lanes.lane(i)->capacity()),
+                static_cast<unsigned>(pushed[i]),
+                static_cast<unsigned>(lanes.lane(i)->size()),
+                static_cast<unsigned>(lanes.overflow_count(i)));
+    }
+}
+
+/*****************************************************************************/
+
+/* Main Function */
+
+int main()
+{
+    static t_lanes lanes;
+    static t_heap heap;
+    t_std_heap std_heap;
+
+    sbench_title("8 priority classes (ns per message)");
+
+    run("SMultiLaneQueue", lanes);
+    run("SPriorityQueue binary", heap);
+    run("std::priority_queue", std_heap);
+
+    run_overflow();
+
+    return 0;
+}
+
+/*****************************************************************************/
@@ -0,0 +1,273 @@
+/**
+ * @file    bench_numa.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    17-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Producer to consumer latency of a SQueue with SQueueNumaStorage, with
+ * the producer thread on a CPU of the first NUMA node, the consumer thread
+ * on a CPU of the last node, and the buffer bound to the consumer node or
+ * to the producer node. The threads exchange 256 bytes messages in ping
+ * pong (the producer pushes a message, the consumer reads all of it, pops
+ * it and acknowledges it), so the round trip time includes the message
+ * transfer between the nodes.
+ *
+ * On a single node machine only the same node case is measured, and if the
+ * buffer can not be bound, it is measured where it was placed.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2022 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ libraries
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <thread>
+
+// POSIX libraries
+#include <pthread.h>
+#include <sched.h>
+
+// Static Queue
+#include "snumastorage.hpp"
+#include "squeue.hpp"
+
+// Benchmark helpers
+#include "sbench.hpp"
+
+/*****************************************************************************/
+
+/* Benchmark Configuration */
+
+static const uint64_t QUEUE_SIZE = 1024U;
+
+/**
+ * @brief Number of messages on each measure.
+ */
+static const uint32_t MESSAGES = 20000U;
+
+/*****************************************************************************/
+
+/* Benchmark Data Types */
+
+struct t_order
+{
+    uint64_t sequence;
+    uint64_t fields[31];
+};
+
+typedef SQueue<t_order, QUEUE_SIZE, SQueueNumaStorage> t_queue;
+
+/*****************************************************************************/
+
+/* Benchmark Helpers */
+
+/**
+ * @brief Get the number of NUMA nodes of the system (1 if unknown).
+ */
+static int num_nodes()
+{
+    int nodes = 0;
+    char path[64];
+
+    for ( ; nodes < 1024; nodes++ )
+    {
+        FILE* file;
+
+        std::snprintf(path, sizeof(path),
+                "/sys/devices/system/node/node%d/cpulist", nodes);
+        file = std::fopen(path, "r");
+        if ( file == nullptr )
+            break;
+        std::fclose(file);
+    }
+
+    return ( nodes == 0 ) ? 1 : nodes;
+}
+
+/**
+ * @brief Get a CPU of a NUMA node.
+ * @param node NUMA node number.
+ * @param index Position of the CPU in the node CPUs list (the last CPU of
+ * the node is returned if it has less CPUs).
+ * @return int The CPU number (0 if unknown).
+ */
+static int node_cpu(int node, int index)
+{
+    int cpu = 0;
+    int first, last;
+    char path[64];
+    FILE* file;
+
+    std::snprintf(path, sizeof(path),
+            "/sys/devices/system/node/node%d/cpulist", node);
+    file = std::fopen(path, "r");
+    if ( file == nullptr )
+        return 0;
+
+    // First range of the list ("0-7,16-23" or "3")
+    if ( std::fscanf(file, "%d-%d", &first, &last) == 2 )
+        cpu = ( (first + index) <= last ) ? (first + index) : last;
+    else
+        cpu = first;
+    std::fclose(file);
+
+    return cpu;
+}
+
+/**
+ * @brief Pin the calling thread to a CPU (it keeps running anywhere if it
+ * fails).
+ */
+static void pin(int cpu)
+{
+    cpu_set_t set;
+
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+}
+
+/**
+ * @brief Wait for an atomic value, yielding the CPU while waiting (so it
+ * also works when both threads share a CPU).
+ */
+static void wait_for(const std::atomic<uint32_t>& value, uint32_t expected)
+{
+    uint32_t spins = 0U;
+
+    while ( value.load(std::memory_order_acquire) != expected )
+    {
+        spins = spins + 1U;
+        if ( (spins % 64U) == 0U )
+            sched_yield();
+    }
+}
+
+/**
+ * @brief Measure the round trip of the messages between a producer and a
+ * consumer pinned to the given CPUs.
+ * @return double Nanoseconds per round trip.
+ */
+static double ping_pong(t_queue& queue, int producer_cpu, int consumer_cpu)
+{
+    std::atomic<uint32_t> pushed(0U);
+    std::atomic<uint32_t> acked(0U);
+    uint64_t check = 0U;
+    double ns;
+
+    std::thread consumer([&]()
+    {
+        pin(consumer_cpu);
+        for ( uint32_t i = 1U; i <= (MESSAGES * SBENCH_RUNS); i++ )
+        {
+            const t_order* order;
+
+            wait_for(pushed, i);
+            order = queue.front();
+            for ( uint32_t f = 0U; f < 31U; f++ )
+                check = check + order->fields[f];
+            check = check + order->sequence;
+            queue.pop();
+            acked.store(i, std::memory_order_release);
+        }
+    });
+
+    pin(producer_cpu);
+    ns = sbench_measure(
+        [&]()
+        {
+            t_order order;
+
+            for ( uint32_t f = 0U; f < 31U; f++ )
+                order.fields[f] = f;
+            for ( uint32_t i = 0U; i < MESSAGES; i++ )
+            {
+                uint32_t next = pushed.load(std::memory_order_relaxed) + 1U;
+
+                order.sequence = next;
+                queue.push(order);
+                pushed.store(next, std::memory_order_release);
+                wait_for(acked, next);
+            }
+        }, MESSAGES);
+    consumer.join();
+    SBENCH_KEEP(check);
+
+    return ns;
+}
+
+/*****************************************************************************/
+
+/* Main Function */
+
+int main()
+{
+    static t_queue queue;
+    int nodes = num_nodes();
+    int producer_node = 0;
+    int consumer_node = nodes - 1;
+    int producer_cpu = node_cpu(producer_node, 0);
+    int consumer_cpu = node_cpu(consumer_node, 1);
+    char name[64];
+
+    if ( !queue.storage().valid() )
+    {
+        std::printf("Can not map the NUMA storage\n");
+        return 1;
+    }
+
+    std::printf("\n%d NUMA nodes, producer on CPU %d (node %d), consumer on "
+            "CPU %d (node %d)\n", nodes, producer_cpu, producer_node,
+            consumer_cpu, consumer_node);
+    std::printf("256 bytes messages round trip (ns per message)\n");
+
+    if ( queue.storage().bind(consumer_node) )
+        std::snprintf(name, sizeof(name), "Buffer on consumer node %d",
+                consumer_node);
+    else
+        std::snprintf(name, sizeof(name), "Buffer not bound (node %d)",
+                queue.storage().node());
+    sbench_report(name, ping_pong(queue, producer_cpu, consumer_cpu));
+
+    if ( nodes == 1 )
+    {
+        std::printf("Single NUMA node, cross node placement not measured\n");
+        return 0;
+    }
+
+    if ( !queue.storage().bind(producer_node) )
+    {
+        std::printf("Can not bind the buffer to node %d\n", producer_node);
+        return 0;
+    }
+    std::snprintf(name, sizeof(name), "Buffer on producer node %d "
+            "(remote)", producer_node);
+    sbench_report(name, ping_pong(queue, producer_cpu, consumer_cpu));
+
+    return 0;
+}
+
+/*****************************************************************************/
@@ -0,0 +1,161 @@
+/**
+ * @file    bench_numqueue.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    17-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * SNumQueue window aggregates (sum, min, max and dot product, with the SIMD
+ * kernels selected for the running CPU) against scalar loops over the
+ * elements of the same wrapped around window, for float and int32_t.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2022 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ libraries
+#include <cstdint>
+#include <cstdio>
+
+// Static Queue
+#include "snumqueue.hpp"
+
+// Benchmark helpers
+#include "sbench.hpp"
+
+/*****************************************************************************/
+
+/* Benchmark Configuration */
+
+static const uint64_t WINDOW = 4096U;
+
+/**
+ * @brief Number of aggregates computed on each measure.
+ */
+static const uint64_t ROUNDS = 256U;
+
+/*****************************************************************************/
+
+/* Benchmark Cases */
+
+template <typename T_ELEMENT, typename T_SUM>
+static void run(const char* title)
+{
+    typedef SNumQueue<T_ELEMENT, WINDOW> t_queue;
+    typedef typename t_queue::size_type size_type;
+    static t_queue window;
+    static T_ELEMENT coefficients[WINDOW];
+    const uint64_t ops = WINDOW * ROUNDS;
+    double ns;
+
+    // Full window with its front at a quarter of the buffer
+    for ( uint64_t i = 0U; i < (WINDOW + (WINDOW / 4U)); i++ )
+        window.push(static_cast<T_ELEMENT>((i * 7U) % 1000U));
+    for ( uint64_t i = 0U; i < WINDOW; i++ )
+        coefficients[i] = static_cast<T_ELEMENT>(i % 3U);
+
+    sbench_title(title);
+
+    ns = sbench_measure([&]() {
+        for ( uint64_t r = 0U; r < ROUNDS; r++ )
+            SBENCH_KEEP(window.sum());
+    }, ops);
+    sbench_report("sum() SIMD", ns);
+
+    ns = sbench_measure([&]() {
+        for ( uint64_t r = 0U; r < ROUNDS; r++ )
+        {
+            T_SUM sum = 0;
+            for ( size_type i = 0U; i < window.size(); i++ )
+                sum = sum + window[i];
+            SBENCH_KEEP(sum);
+        }
+    }, ops);
+    sbench_report("sum() scalar loop", ns);
+
+    ns = sbench_measure([&]() {
+        for ( uint64_t r = 0U; r < ROUNDS; r++ )
+            SBENCH_KEEP(window.min());
+    }, ops);
+    sbench_report("min() SIMD", ns);
+
+    ns = sbench_measure([&]() {
+        for ( uint64_t r = 0U; r < ROUNDS; r++ )
+        {
+            T_ELEMENT min = window[0];
+            for ( size_type i = 1U; i < window.size(); i++ )
+                min = ( window[i] < min ) ? window[i] : min;
+            SBENCH_KEEP(min);
+        }
+    }, ops);
+    sbench_report("min() scalar loop", ns);
+
+    ns = sbench_measure([&]() {
+        for ( uint64_t r = 0U; r < ROUNDS; r++ )
+            SBENCH_KEEP(window.max());
+    }, ops);
+    sbench_report("max() SIMD", ns);
+
+    ns = sbench_measure([&]() {
+        for ( uint64_t r = 0U; r < ROUNDS; r++ )
+        {
+            T_ELEMENT max = window[0];
+            for ( size_type i = 1U; i < window.size(); i++ )
+                max = ( window[i] > max ) ? window[i] : max;
+            SBENCH_KEEP(max);
+        }
+    }, ops);
+    sbench_report("max() scalar loop", ns);
+
+    ns = sbench_measure([&]() {
+        for ( uint64_t r = 0U; r < ROUNDS; r++ )
+            SBENCH_KEEP(window.dot(coefficients));
+    }, ops);
+    sbench_report("dot() SIMD", ns);
+
+    ns = sbench_measure([&]() {
+        for ( uint64_t r = 0U; r < ROUNDS; r++ )
+        {
+            T_SUM dot = 0;
+            for ( size_type i = 0U; i < window.size(); i++ )
+                dot = dot + (static_cast<T_SUM>(window[i]) * coefficients[i]);
+            SBENCH_KEEP(dot);
+        }
+    }, ops);
+    sbench_report("dot() scalar loop", ns);
+}
+
+/*****************************************************************************/
+
+/* Main Function */
+
+int main()
+{
+    run<float, float>("SNumQueue<float, 4096> aggregates (ns per element)");
+    run<int32_t, int64_t>(
+            "SNumQueue<int32_t, 4096> aggregates (ns per element)");
+
+    return 0;
+}
+
+/*****************************************************************************/
@@ -0,0 +1,205 @@
+/**
+ * @file    bench_objectpool.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    17-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Large messages (1 to 8 KB) passed through a Queue: by value in a SQueue
+ * of messages (the message is built and then copied into the Queue) against
+ * SPooledQueue and a SAtomicObjectPool with a SQueue of handles (the message
+ * is built in place in a pool object and only its handle is queued).
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2022 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ libraries
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+// Static Queue
+#include "sobjectpool.hpp"
+#include "squeue.hpp"
+
+// Benchmark helpers
+#include "sbench.hpp"
+
+/*****************************************************************************/
+
+/* Benchmark Configuration */
+
+static const uint32_t QUEUE_SIZE = 64U;
+
+static const uint32_t BATCH = 16U;
+
+/**
+ * @brief Number of batches on each measure.
+ */
+static const uint32_t BATCHES = 4096U;
+
+/*****************************************************************************/
+
+/* Benchmark Data Types */
+
+template <size_t MESSAGE_SIZE>
+struct t_message
+{
+    uint64_t sequence;
+    uint32_t length;
+    uint8_t payload[MESSAGE_SIZE - 12U];
+};
+
+static uint8_t source[8192];
+
+/*****************************************************************************/
+
+/* Benchmark Helpers */
+
+/**
+ * @brief Build a message in place.
+ */
+template <typename T_MESSAGE>
+static void build(T_MESSAGE& message, uint64_t sequence)
+{
+    message.sequence = sequence;
+    message.length = sizeof(message.payload);
+    std::memcpy(message.payload, source, sizeof(message.payload));
+}
+
+/**
+ * @brief Read a message fields.
+ */
+template <typename T_MESSAGE>
+static uint64_t consume(const T_MESSAGE& message)
+{
+    return message.sequence + message.payload[message.length - 1U];
+}
+
+/*****************************************************************************/
+
+/* Benchmark Cases */
+
+template <size_t MESSAGE_SIZE>
+static void run()
+{
+    typedef t_message<MESSAGE_SIZE> t_msg;
+    static SQueue<t_msg, QUEUE_SIZE> by_value;
+    static SPooledQueue<t_msg, QUEUE_SIZE> pooled;
+    static SAtomicObjectPool<t_msg, QUEUE_SIZE> atomic_pool;
+    static SQueue<t_pool_handle, QUEUE_SIZE> handles;
+    double ns;
+
+    std::printf("\nMessages of %u bytes (ns per message)\n",
+            static_cast<unsigned>(sizeof(t_msg)));
+
+    ns = sbench_measure(
+        [&]()
+        {
+            uint64_t check = 0U;
+            t_msg message;
+
+            for ( uint32_t b = 0U; b < BATCHES; b++ )
+            {
+                for ( uint32_t i = 0U; i < BATCH; i++ )
+                {
+                    build(message, (b * BATCH) + i);
+                    by_value.push(message);
+                }
+                for ( uint32_t i = 0U; i < BATCH; i++ )
+                {
+                    check = check + consume(*(by_value.front()));
+                    by_value.pop();
+                }
+            }
+            SBENCH_KEEP(check);
+        }, BATCHES * BATCH);
+    sbench_report("SQueue push() by value", ns);
+
+    ns = sbench_measure(
+        [&]()
+        {
+            uint64_t check = 0U;
+
+            for ( uint32_t b = 0U; b < BATCHES; b++ )
+            {
+                for ( uint32_t i = 0U; i < BATCH; i++ )
+                {
+                    t_msg* message = pooled.acquire();
+                    build(*message, (b * BATCH) + i);
+                    pooled.push(message);
+                }
+                for ( uint32_t i = 0U; i < BATCH; i++ )
+                {
+                    check = check + consume(*(pooled.front()));
+                    pooled.pop();
+                }
+            }
+            SBENCH_KEEP(check);
+        }, BATCHES * BATCH);
+    sbench_report("SPooledQueue in place", ns);
+
+    ns = sbench_measure(
+        [&]()
+        {
+            uint64_t check = 0U;
+
+            for ( uint32_t b = 0U; b < BATCHES; b++ )
+            {
+                for ( uint32_t i = 0U; i < BATCH; i++ )
+                {
+                    t_pool_handle handle = atomic_pool.acquire();
+                    build(*(atomic_pool.get(handle)), (b * BATCH) + i);
+                    handles.push(handle);
+                }
+                for ( uint32_t i = 0U; i < BATCH; i++ )
+                {
+                    t_pool_handle handle = *(handles.front());
+                    check = check + consume(*(atomic_pool.get(handle)));
+                    atomic_pool.release(handle);
+                    handles.pop();
+                }
+            }
+            SBENCH_KEEP(check);
+        }, BATCHES * BATCH);
+    sbench_report("SAtomicObjectPool + SQueue of handles", ns);
+}
+
+/*****************************************************************************/
+
+/* Main Function */
+
+int main()
+{
+    std::memset(source, 0x42, sizeof(source));
+
+    run<1024U>();
+    run<2048U>();
+    run<4096U>();
+    run<8192U>();
+
+    return 0;
+}
+
+/*****************************************************************************/
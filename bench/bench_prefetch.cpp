@@ -0,0 +1,161 @@
+/**
+ * @file    bench_prefetch.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    17-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * SQueue drain() throughput with and without software prefetch, for
+ * elements of 64 B to 4 KB, in Queues of 256 MB (larger than the CPU
+ * caches). drain() prefetches each cache line of the elements, up to
+ * SQUEUE_PREFETCH_MAX_BYTES. It is measured with three consumers: one that
+ * reads two cache lines of each element (the first and the middle ones),
+ * so the hardware stream prefetcher can not follow the large elements, one
+ * that also does some work per element (a short hash), that limits how far
+ * ahead the CPU can load by itself, and one that reads every cache line.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2022 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ libraries
+#include <cstdint>
+#include <cstdio>
+
+// Static Queue
+#include "sheapstorage.hpp"
+
+// Benchmark helpers
+#include "sbench.hpp"
+
+/*****************************************************************************/
+
+/* Benchmark Configuration */
+
+static const size_t QUEUE_BYTES = 256U * 1024U * 1024U;
+
+/**
+ * @brief Number of hash rounds per element of the consumer that works.
+ */
+static const int WORK_ROUNDS = 24;
+
+/*****************************************************************************/
+
+/* Benchmark Data Types */
+
+template <size_t ELEMENT_SIZE>
+struct t_blob
+{
+    uint64_t id;
+    uint8_t payload[ELEMENT_SIZE - sizeof(uint64_t)];
+};
+
+/*****************************************************************************/
+
+/* Benchmark Cases */
+
+template <size_t ELEMENT_SIZE>
+static void run()
+{
+    typedef t_blob<ELEMENT_SIZE> t_element;
+    const size_t count = QUEUE_BYTES / ELEMENT_SIZE;
+    const int rounds[] = { 0, 0, WORK_ROUNDS, WORK_ROUNDS, 0, 0 };
+    const bool all_lines[] = { false, false, false, false, true, true };
+    const uint32_t distances[] = { 0U, SQUEUE_PREFETCH_DISTANCE,
+            0U, SQUEUE_PREFETCH_DISTANCE, 0U, SQUEUE_PREFETCH_DISTANCE };
+    SDynQueue<t_element> queue(count);
+    t_element element;
+    char name[64];
+
+    if ( !queue.storage().valid() )
+    {
+        std::printf("Can not allocate the %u B elements Queue\n",
+                static_cast<unsigned>(ELEMENT_SIZE));
+        return;
+    }
+
+    for ( size_t i = 0U; i < sizeof(element.payload); i++ )
+        element.payload[i] = static_cast<uint8_t>(i);
+
+    std::printf("\nElements of %u bytes (ns per element)\n",
+            static_cast<unsigned>(ELEMENT_SIZE));
+
+    for ( int c = 0; c < 6; c++ )
+    {
+        const int work = rounds[c];
+        const size_t step = all_lines[c] ? 64U : sizeof(element.payload);
+        const uint32_t distance = distances[c];
+        double ns = sbench_measure(
+            [&]()
+            {
+                // Front at the middle of the buffer, the back pushes evict
+                // the front elements from the cache
+                queue.clear();
+                for ( size_t i = 0U; i < (count / 2U); i++ )
+                    queue.push(element);
+                queue.drain([](t_element&) {}, count / 2U, 0U);
+                for ( size_t i = 0U; i < count; i++ )
+                {
+                    element.id = i;
+                    queue.push(element);
+                }
+            },
+            [&]()
+            {
+                uint64_t sum = 0U;
+                queue.drain(
+                    [&](const t_element& e)
+                    {
+                        sum = sum + e.id + e.payload[ELEMENT_SIZE / 2U];
+                        for ( size_t b = 56U; b < sizeof(e.payload);
+                              b += step )
+                            sum = sum + e.payload[b];
+                        for ( int k = 0; k < work; k++ )
+                            sum = (sum * 0x9E3779B97F4A7C15ULL) ^ (sum >> 29);
+                    }, count, distance);
+                SBENCH_KEEP(sum);
+            }, count);
+
+        std::snprintf(name, sizeof(name), "%s, prefetch distance %u",
+                all_lines[c] ? "all lines" :
+                (( work == 0 ) ? "two lines" : "two lines with work"),
+                static_cast<unsigned>(distance));
+        sbench_report(name, ns);
+    }
+}
+
+/*****************************************************************************/
+
+/* Main Function */
+
+int main()
+{
+    run<64U>();
+    run<256U>();
+    run<1024U>();
+    run<4096U>();
+
+    return 0;
+}
+
+/*****************************************************************************/
@@ -0,0 +1,195 @@
+/**
+ * @file    bench_priorityqueue.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    17-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * SPriorityQueue (4-ary and binary heaps) against std::priority_queue
+ * (over a reserved std::vector), for push and pop heavy workloads: a hold
+ * workload (a pop and a push of a random priority on a Queue that keeps N
+ * elements) and a fill then drain workload, with 16 bytes messages ordered
+ * by priority.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2022 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ libraries
+#include <cstdint>
+#include <cstdio>
+#include <queue>
+#include <vector>
+
+// Static Queue
+#include "spriorityqueue.hpp"
+
+// Benchmark helpers
+#include "sbench.hpp"
+
+/*****************************************************************************/
+
+/* Benchmark Configuration */
+
+/**
+ * @brief Number of operations of the hold workload on each measure.
+ */
+static const uint32_t HOLD_OPS = 1048576U;
+
+/*****************************************************************************/
+
+/* Benchmark Data Types */
+
+struct t_message
+{
+    uint64_t priority;
+    uint64_t id;
+
+    bool operator<(const t_message& other) const
+    {
+        return ( priority < other.priority );
+    }
+};
+
+/*****************************************************************************/
+
+/* Benchmark Helpers */
+
+/**
+ * @brief Random priorities generator.
+ */
+struct t_priorities
+{
+    uint64_t state = 12345U;
+
+    uint64_t next()
+    {
+        state = (state * 6364136223846793005ULL) + 1442695040888963407ULL;
+        return state >> 40;
+    }
+};
+
+/*****************************************************************************/
+
+/* Benchmark Cases */
+
+/**
+ * @brief Measure the hold and fill then drain workloads of a priority
+ * Queue with push(), pop() and a top element accessor.
+ */
+template <typename T_QUEUE, typename T_TOP>
+static void run(const char* name, T_QUEUE& queue, uint32_t n, T_TOP top)
+{
+    char label[64];
+    double ns;
+
+    ns = sbench_measure(
+        [&]()
+        {
+            t_priorities priorities;
+
+            while ( !queue.empty() )
+                queue.pop();
+            for ( uint32_t i = 0U; i < n; i++ )
+                queue.push(t_message{ priorities.next(), i });
+        },
+        [&]()
+        {
+            t_priorities priorities;
+            uint64_t check = 0U;
+
+            for ( uint32_t i = 0U; i < HOLD_OPS; i++ )
+            {
+                check = check + top(queue).id;
+                queue.pop();
+                queue.push(t_message{ priorities.next(), i });
+            }
+            SBENCH_KEEP(check);
+        }, HOLD_OPS);
+    std::snprintf(label, sizeof(label), "%s hold", name);
+    sbench_report(label, ns);
+
+    ns = sbench_measure(
+        [&]()
+        {
+            while ( !queue.empty() )
+                queue.pop();
+        },
+        [&]()
+        {
+            t_priorities priorities;
+            uint64_t check = 0U;
+
+            for ( uint32_t i = 0U; i < n; i++ )
+                queue.push(t_message{ priorities.next(), i });
+            while ( !queue.empty() )
+            {
+                check = check + top(queue).id;
+                queue.pop();
+            }
+            SBENCH_KEEP(check);
+        }, n);
+    std::snprintf(label, sizeof(label), "%s fill and drain", name);
+    sbench_report(label, ns);
+}
+
+template <uint32_t QUEUE_SIZE>
+static void run_size()
+{
+    static SPriorityQueue<t_message, QUEUE_SIZE> heap4;
+    static SPriorityQueue<t_message, QUEUE_SIZE, std::less<t_message>,
+            PRIORITY_DROP_LOWEST, 2U> heap2;
+    std::vector<t_message> storage;
+
+    storage.reserve(QUEUE_SIZE);
+    std::priority_queue<t_message> std_queue(std::less<t_message>(),
+            std::move(storage));
+
+    std::printf("\n%u elements (ns per element)\n",
+            static_cast<unsigned>(QUEUE_SIZE));
+
+    run("SPriorityQueue 4-ary", heap4, QUEUE_SIZE,
+        [](SPriorityQueue<t_message, QUEUE_SIZE>& q) -> const t_message&
+        { return *(q.top()); });
+    run("SPriorityQueue binary", heap2, QUEUE_SIZE,
+        [](SPriorityQueue<t_message, QUEUE_SIZE, std::less<t_message>,
+                PRIORITY_DROP_LOWEST, 2U>& q) -> const t_message&
+        { return *(q.top()); });
+    run("std::priority_queue", std_queue, QUEUE_SIZE,
+        [](std::priority_queue<t_message>& q) -> const t_message&
+        { return q.top(); });
+}
+
+/*****************************************************************************/
+
+/* Main Function */
+
+int main()
+{
+    run_size<1024U>();
+    run_size<65536U>();
+
+    return 0;
+}
+
+/*****************************************************************************/
@@ -0,0 +1,252 @@
+/**
+ * @file    bench_queuemerger.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    17-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * SQueueMerger against a linear scan of all the Queues fronts, merging K
+ * = 4, 16 and 64 feed Queues of events ordered by timestamp (with random
+ * gaps, so the feeds interleave). It is measured draining all the Queues,
+ * and in a steady state where each merged event is replaced by a new one
+ * pushed to the end of its feed.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2022 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ libraries
+#include <cstdint>
+#include <cstdio>
+
+// Static Queue
+#include "squeue.hpp"
+#include "squeuemerger.hpp"
+
+// Benchmark helpers
+#include "sbench.hpp"
+
+/*****************************************************************************/
+
+/* Benchmark Configuration */
+
+static const uint32_t FEED_SIZE = 4096U;
+
+/**
+ * @brief Number of events merged on each steady state measure.
+ */
+static const uint32_t OPS = 1048576U;
+
+/*****************************************************************************/
+
+/* Benchmark Data Types */
+
+struct t_event
+{
+    uint64_t timestamp;
+    uint64_t payload;
+};
+
+struct t_timestamp
+{
+    uint64_t operator()(const t_event& event) const
+    {
+        return event.timestamp;
+    }
+};
+
+typedef SQueue<t_event, FEED_SIZE> t_feed;
+
+/*****************************************************************************/
+
+/* Benchmark Helpers */
+
+/**
+ * @brief Events generator of a feed, with timestamp gaps of 1 to 64.
+ */
+struct t_source
+{
+    uint32_t state;
+    uint64_t timestamp;
+
+    t_event next()
+    {
+        state = (state * 1664525U) + 1013904223U;
+        timestamp = timestamp + 1U + ((state >> 16) & 0x3FU);
+
+        return t_event{ timestamp, state };
+    }
+};
+
+/**
+ * @brief Linear scan merge: the feed with the lowest front timestamp (the
+ * lowest feed number on equal timestamps).
+ */
+template <uint32_t K>
+static uint32_t scan_top(t_feed* feeds)
+{
+    uint32_t winner = K;
+    uint64_t lowest = 0U;
+
+    for ( uint32_t i = 0U; i < K; i++ )
+    {
+        if ( feeds[i].empty() )
+            continue;
+        if ( (winner == K) || (feeds[i].front()->timestamp < lowest) )
+        {
+            winner = i;
+            lowest = feeds[i].front()->timestamp;
+        }
+    }
+
+    return winner;
+}
+
+/*****************************************************************************/
+
+/* Benchmark Cases */
+
+template <uint32_t K>
+static void run()
+{
+    typedef SQueueMerger<t_feed, K, t_timestamp> t_merger;
+    static t_feed feeds[K];
+    static t_source sources[K];
+    t_feed* queues[K];
+    uint64_t order_errors = 0U;
+    char name[64];
+    double ns;
+
+    for ( uint32_t i = 0U; i < K; i++ )
+        queues[i] = &(feeds[i]);
+    t_merger merger(queues);
+
+    auto fill = [&]()
+    {
+        for ( uint32_t i = 0U; i < K; i++ )
+        {
+            feeds[i].clear();
+            sources[i] = t_source{ i + 1U, 0U };
+            for ( uint32_t n = 0U; n < FEED_SIZE; n++ )
+                feeds[i].push(sources[i].next());
+        }
+        merger.rebuild();
+    };
+
+    std::printf("\nK = %u feeds (ns per merged event)\n",
+            static_cast<unsigned>(K));
+
+    ns = sbench_measure(fill,
+        [&]()
+        {
+            uint64_t check = 0U, last = 0U;
+            t_event* event;
+
+            while ( (event = merger.front()) != nullptr )
+            {
+                order_errors += ( event->timestamp < last ) ? 1U : 0U;
+                last = event->timestamp;
+                check = check + event->payload;
+                merger.pop();
+            }
+            SBENCH_KEEP(check);
+        }, K * FEED_SIZE);
+    std::snprintf(name, sizeof(name), "SQueueMerger, drain");
+    sbench_report(name, ns);
+
+    ns = sbench_measure(fill,
+        [&]()
+        {
+            uint64_t check = 0U, last = 0U;
+            uint32_t winner;
+
+            while ( (winner = scan_top<K>(feeds)) < K )
+            {
+                order_errors += ( feeds[winner].front()->timestamp < last ) ?
+                        1U : 0U;
+                last = feeds[winner].front()->timestamp;
+                check = check + feeds[winner].front()->payload;
+                feeds[winner].pop();
+            }
+            SBENCH_KEEP(check);
+        }, K * FEED_SIZE);
+    std::snprintf(name, sizeof(name), "linear scan, drain");
+    sbench_report(name, ns);
+
+    ns = sbench_measure(fill,
+        [&]()
+        {
+            uint64_t check = 0U;
+
+            for ( uint32_t i = 0U; i < OPS; i++ )
+            {
+                uint32_t winner = merger.top_queue();
+
+                check = check + feeds[winner].front()->payload;
+                merger.pop();
+                feeds[winner].push(sources[winner].next());
+            }
+            SBENCH_KEEP(check);
+        }, OPS);
+    std::snprintf(name, sizeof(name), "SQueueMerger, steady state");
+    sbench_report(name, ns);
+
+    ns = sbench_measure(fill,
+        [&]()
+        {
+            uint64_t check = 0U;
+
+            for ( uint32_t i = 0U; i < OPS; i++ )
+            {
+                uint32_t winner = scan_top<K>(feeds);
+
+                check = check + feeds[winner].front()->payload;
+                feeds[winner].pop();
+                feeds[winner].push(sources[winner].next());
+            }
+            SBENCH_KEEP(check);
+        }, OPS);
+    std::snprintf(name, sizeof(name), "linear scan, steady state");
+    sbench_report(name, ns);
+
+    if ( order_errors != 0U )
+    {
+        std::printf("Merge order errors: %llu\n",
+                static_cast<unsigned long long>(order_errors));
+    }
+}
+
+/*****************************************************************************/
+
+/* Main Function */
+
+int main()
+{
+    run<4U>();
+    run<16U>();
+    run<64U>();
+
+    return 0;
+}
+
+/*****************************************************************************/
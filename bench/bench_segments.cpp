@@ -0,0 +1,127 @@
+/**
+ * @file    bench_segments.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    17-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Sum of the floats of a wrapped around SQueue, traversed with
+ * for_each_segment() (plain array loops that the compiler can vectorize),
+ * with the random access operator[] and with a front()/pop() loop. It is
+ * built with -ffast-math, as the compiler only vectorizes a float sum if it
+ * can reorder the additions.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2022 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ libraries
+#include <cstdint>
+
+// Static Queue
+#include "squeue.hpp"
+
+// Benchmark helpers
+#include "sbench.hpp"
+
+/*****************************************************************************/
+
+/* Benchmark Configuration */
+
+static const uint64_t QUEUE_SIZE = 65536U;
+
+typedef SQueue<float, QUEUE_SIZE> t_queue;
+
+static t_queue queue;
+
+/*****************************************************************************/
+
+/* Benchmark Helpers */
+
+/**
+ * @brief Fill the Queue with its front at the middle of the buffer, so the
+ * elements are split in two segments.
+ */
+static void fill()
+{
+    queue.clear();
+    for ( uint64_t i = 0U; i < (QUEUE_SIZE / 2U); i++ )
+        queue.push(0.0f);
+    for ( uint64_t i = 0U; i < (QUEUE_SIZE / 2U); i++ )
+        queue.pop();
+    for ( uint64_t i = 0U; i < QUEUE_SIZE; i++ )
+        queue.push(static_cast<float>(i % 100U) * 0.5f);
+}
+
+/*****************************************************************************/
+
+/* Main Function */
+
+int main()
+{
+    double ns;
+
+    sbench_title("Sum of 65536 floats of a wrapped SQueue");
+
+    fill();
+    ns = sbench_measure(
+        [&]()
+        {
+            float sum = 0.0f;
+            queue.for_each_segment(
+                [&](const float* data, t_queue::size_type n)
+                {
+                    for ( t_queue::size_type i = 0U; i < n; i++ )
+                        sum = sum + data[i];
+                });
+            SBENCH_KEEP(sum);
+        }, QUEUE_SIZE);
+    sbench_report("for_each_segment()", ns);
+
+    ns = sbench_measure(
+        [&]()
+        {
+            float sum = 0.0f;
+            for ( t_queue::size_type i = 0U; i < queue.size(); i++ )
+                sum = sum + queue[i];
+            SBENCH_KEEP(sum);
+        }, QUEUE_SIZE);
+    sbench_report("operator[]", ns);
+
+    ns = sbench_measure(fill,
+        [&]()
+        {
+            float sum = 0.0f;
+            while ( !queue.empty() )
+            {
+                sum = sum + *(queue.front());
+                queue.pop();
+            }
+            SBENCH_KEEP(sum);
+        }, QUEUE_SIZE);
+    sbench_report("front()/pop()", ns);
+
+    return 0;
+}
+
+/*****************************************************************************/
@@ -0,0 +1,258 @@
+/**
+ * @file    bench_shmqueue.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    17-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Two process message exchange: a producer process and a consumer process
+ * (forked from it) exchange 64 bytes messages through a SShmQueue in the
+ * SPSC and MPSC modes, written with push() and with push_stream()
+ * (non-temporal stores), and through a UNIX socket pair (one write() and
+ * one read() per message) as reference. The consumer checks the sequence
+ * and the payload of every message.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2022 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ libraries
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+// POSIX libraries
+#include <sched.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+// Shared memory Queue
+#include "sshmqueue.hpp"
+
+// Benchmark helpers
+#include "sbench.hpp"
+
+/*****************************************************************************/
+
+/* Benchmark Configuration */
+
+/**
+ * @brief Number of messages exchanged on each measure.
+ */
+static const uint32_t MESSAGES = 200000U;
+
+static const uint32_t QUEUE_SIZE = 4096U;
+
+/*****************************************************************************/
+
+/* Benchmark Data Types */
+
+struct t_message
+{
+    uint32_t sequence;
+    uint8_t payload[60];
+};
+
+/*****************************************************************************/
+
+/* Benchmark Helpers */
+
+/**
+ * @brief Wait for the consumer process.
+ * @return true if it has received all the messages in order.
+ */
+static bool wait_consumer(pid_t pid)
+{
+    int status = 0;
+
+    if ( waitpid(pid, &status, 0) != pid )
+        return false;
+
+    return ( WIFEXITED(status) && (WEXITSTATUS(status) == 0) );
+}
+
+/**
+ * @brief Exchange the messages through a shared memory Queue.
+ * @return true if the consumer has received all the messages in order.
+ */
+template <t_shm_mode SHM_MODE, bool STREAM>
+static bool exchange_shm(const char* name)
+{
+    typedef SShmQueue<t_message, QUEUE_SIZE, SHM_MODE> t_queue;
+    t_queue producer;
+    t_message message;
+    pid_t pid;
+    bool result;
+
+    if ( !producer.create(name) )
+        return false;
+
+    pid = fork();
+    if ( pid == 0 )
+    {
+        t_queue consumer;
+        uint32_t expected = 0U;
+
+        if ( !consumer.attach(name) )
+            _exit(1);
+        while ( expected < MESSAGES )
+        {
+            t_message* received = consumer.front();
+
+            if ( received == nullptr )
+            {
+                sched_yield();
+                continue;
+            }
+            if ( (received->sequence != expected) ||
+                 (received->payload[0] != 0xA5U) ||
+                 (received->payload[sizeof(received->payload) - 1U] !=
+                  0xA5U) )
+                _exit(1);
+            consumer.pop();
+            expected = expected + 1U;
+        }
+        _exit(0);
+    }
+
+    std::memset(&message, 0xA5, sizeof(message));
+    for ( uint32_t i = 0U; (pid > 0) && (i < MESSAGES); i++ )
+    {
+        message.sequence = i;
+        while ( (STREAM ? producer.push_stream(message) :
+                 producer.push(message)) != BUFFER_OK )
+            sched_yield();
+    }
+
+    result = ( pid > 0 ) && wait_consumer(pid);
+    producer.detach();
+    t_queue::remove(name);
+
+    return result;
+}
+
+/**
+ * @brief Exchange the messages through a UNIX socket pair.
+ * @return true if the consumer has received all the messages in order.
+ */
+static bool exchange_socket()
+{
+    t_message message;
+    int fds[2];
+    pid_t pid;
+    bool result;
+
+    if ( socketpair(AF_UNIX, SOCK_STREAM, 0, fds) != 0 )
+        return false;
+
+    pid = fork();
+    if ( pid == 0 )
+    {
+        uint32_t expected = 0U;
+
+        close(fds[0]);
+        while ( expected < MESSAGES )
+        {
+            size_t done = 0U;
+
+            while ( done < sizeof(message) )
+            {
+                ssize_t n = read(fds[1],
+                        reinterpret_cast<uint8_t*>(&message) + done,
+                        sizeof(message) - done);
+                if ( n <= 0 )
+                    _exit(1);
+                done = done + static_cast<size_t>(n);
+            }
+            if ( message.sequence != expected )
+                _exit(1);
+            expected = expected + 1U;
+        }
+        _exit(0);
+    }
+
+    close(fds[1]);
+    std::memset(&message, 0xA5, sizeof(message));
+    for ( uint32_t i = 0U; (pid > 0) && (i < MESSAGES); i++ )
+    {
+        message.sequence = i;
+        if ( write(fds[0], &message, sizeof(message)) !=
+             static_cast<ssize_t>(sizeof(message)) )
+            break;
+    }
+    close(fds[0]);
+
+    result = ( pid > 0 ) && wait_consumer(pid);
+
+    return result;
+}
+
+/*****************************************************************************/
+
+/* Main Function */
+
+int main()
+{
+    bool ok = true;
+    char name[64];
+    double ns;
+
+    std::snprintf(name, sizeof(name), "/squeue_bench_%d",
+            static_cast<int>(getpid()));
+
+    sbench_title("Two processes, 64 bytes messages (ns per message)");
+
+    ns = sbench_measure(
+            [&]() { ok = ok && exchange_shm<SHM_SPSC, false>(name); },
+            MESSAGES);
+    sbench_report("SShmQueue SPSC", ns);
+
+    ns = sbench_measure(
+            [&]() { ok = ok && exchange_shm<SHM_SPSC, true>(name); },
+            MESSAGES);
+    sbench_report("SShmQueue SPSC, push_stream()", ns);
+
+    ns = sbench_measure(
+            [&]() { ok = ok && exchange_shm<SHM_MPSC, false>(name); },
+            MESSAGES);
+    sbench_report("SShmQueue MPSC (one producer)", ns);
+
+    ns = sbench_measure(
+            [&]() { ok = ok && exchange_shm<SHM_MPSC, true>(name); },
+            MESSAGES);
+    sbench_report("SShmQueue MPSC (one producer), push_stream()", ns);
+
+    ns = sbench_measure([&]() { ok = ok && exchange_socket(); }, MESSAGES);
+    sbench_report("UNIX socket pair", ns);
+
+    if ( !ok )
+    {
+        std::printf("Message exchange failed\n");
+        return 1;
+    }
+
+    return 0;
+}
+
+/*****************************************************************************/
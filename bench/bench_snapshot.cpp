@@ -0,0 +1,192 @@
+/**
+ * @file    bench_snapshot.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    17-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * SQueue snapshot() and restore() throughput for a wrapped Queue of 1M
+ * elements of 16 bytes, to a memory buffer and to a file in /tmp (or in the
+ * directory given as first argument).
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2022 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ libraries
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+// POSIX libraries
+#include <unistd.h>
+
+// Static Queue
+#include "squeue.hpp"
+
+// Benchmark helpers
+#include "sbench.hpp"
+
+/*****************************************************************************/
+
+/* Benchmark Configuration */
+
+static const uint64_t QUEUE_SIZE = 1048576U;
+
+/*****************************************************************************/
+
+/* Benchmark Data Types */
+
+struct t_sample
+{
+    uint64_t timestamp;
+    double value;
+};
+
+typedef SQueue<t_sample, QUEUE_SIZE> t_queue;
+
+static t_queue queue;
+
+/*****************************************************************************/
+
+/* Benchmark Helpers */
+
+/**
+ * @brief Fill the Queue with its front at the middle of the buffer.
+ */
+static void fill()
+{
+    t_sample sample = { 0U, 0.0 };
+
+    queue.clear();
+    for ( uint64_t i = 0U; i < (QUEUE_SIZE + (QUEUE_SIZE / 2U)); i++ )
+    {
+        sample.timestamp = i;
+        sample.value = static_cast<double>(i) * 0.5;
+        queue.push(sample);
+    }
+}
+
+/**
+ * @brief Print the time of a whole snapshot or restore.
+ */
+static void report(const char* name, double ns_per_element)
+{
+    double ms = (ns_per_element * QUEUE_SIZE) / 1000000.0;
+    double mb = static_cast<double>(QUEUE_SIZE * sizeof(t_sample)) /
+            1048576.0;
+
+    std::printf("%-40s %8.2f ms %10.1f MB/s\n", name, ms, mb / (ms / 1000.0));
+}
+
+/*****************************************************************************/
+
+/* Main Function */
+
+int main(int argc, char** argv)
+{
+    const char* dir = ( argc > 1 ) ? argv[1] : "/tmp";
+    static std::vector<uint8_t> memory(
+            sizeof(t_squeue_snapshot) + (QUEUE_SIZE * sizeof(t_sample)));
+    size_t offset = 0U;
+    bool ok = true;
+    char path[256];
+    FILE* file;
+    double ns;
+
+    std::snprintf(path, sizeof(path), "%s/squeue_bench_snapshot_%d", dir,
+            static_cast<int>(getpid()));
+
+    fill();
+    std::printf("\nSnapshot of a wrapped Queue of %llu elements of %u "
+            "bytes\n", static_cast<unsigned long long>(queue.size()),
+            static_cast<unsigned>(sizeof(t_sample)));
+
+    ns = sbench_measure(
+        [&]()
+        {
+            offset = 0U;
+            ok = queue.snapshot(
+                [&](const void* data, size_t size)
+                {
+                    std::memcpy(&(memory[offset]), data, size);
+                    offset = offset + size;
+                    return true;
+                }) && ok;
+        }, QUEUE_SIZE);
+    report("snapshot() to memory", ns);
+
+    ns = sbench_measure(
+        [&]()
+        {
+            offset = 0U;
+            ok = queue.restore(
+                [&](void* data, size_t size)
+                {
+                    std::memcpy(data, &(memory[offset]), size);
+                    offset = offset + size;
+                    return true;
+                }) && ok;
+        }, QUEUE_SIZE);
+    report("restore() from memory", ns);
+
+    ns = sbench_measure(
+        [&]()
+        {
+            file = std::fopen(path, "wb");
+            ok = (file != nullptr) && queue.snapshot(
+                [&](const void* data, size_t size)
+                { return ( std::fwrite(data, 1U, size, file) == size ); }) &&
+                ok;
+            if ( file != nullptr )
+                std::fclose(file);
+        }, QUEUE_SIZE);
+    report("snapshot() to file (page cache)", ns);
+
+    ns = sbench_measure(
+        [&]()
+        {
+            file = std::fopen(path, "rb");
+            ok = (file != nullptr) && queue.restore(
+                [&](void* data, size_t size)
+                { return ( std::fread(data, 1U, size, file) == size ); }) &&
+                ok;
+            if ( file != nullptr )
+                std::fclose(file);
+        }, QUEUE_SIZE);
+    report("restore() from file (page cache)", ns);
+
+    unlink(path);
+
+    if ( !ok || (queue.size() != QUEUE_SIZE) ||
+         (queue.front()->timestamp != (QUEUE_SIZE / 2U)) )
+    {
+        std::printf("Snapshot round trip failed\n");
+        return 1;
+    }
+
+    return 0;
+}
+
+/*****************************************************************************/
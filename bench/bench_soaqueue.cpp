@@ -0,0 +1,153 @@
+/**
+ * @file    bench_soaqueue.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    17-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Single field scans of 1M trade records {timestamp, price, qty, id} (32
+ * bytes, larger than the CPU caches): SoaSQueue column segments against
+ * the records of an array of structs SQueue.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2022 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ libraries
+#include <cstdint>
+#include <cstdio>
+
+// Static Queue
+#include "squeue.hpp"
+#include "ssoaqueue.hpp"
+
+// Benchmark helpers
+#include "sbench.hpp"
+
+/*****************************************************************************/
+
+/* Benchmark Configuration */
+
+static const uint64_t QUEUE_SIZE = 1048576U;
+
+/*****************************************************************************/
+
+/* Benchmark Data Types */
+
+struct t_trade
+{
+    uint64_t timestamp;
+    double price;
+    uint32_t qty;
+    uint64_t id;
+};
+
+typedef SQueue<t_trade, QUEUE_SIZE> t_aos_queue;
+
+typedef SoaSQueue<QUEUE_SIZE, uint64_t, double, uint32_t, uint64_t>
+        t_soa_queue;
+
+static t_aos_queue aos;
+
+static t_soa_queue soa;
+
+/*****************************************************************************/
+
+/* Main Function */
+
+int main()
+{
+    double ns;
+
+    for ( uint64_t i = 0U; i < (QUEUE_SIZE + (QUEUE_SIZE / 4U)); i++ )
+    {
+        t_trade trade = { i, 100.0 + static_cast<double>(i % 1000U) * 0.01,
+                static_cast<uint32_t>(i % 500U), i * 7U };
+
+        aos.push(trade);
+        soa.push(trade.timestamp, trade.price, trade.qty, trade.id);
+    }
+
+    sbench_title("Scan of one field of 1M records of 32 bytes "
+            "(ns per record)");
+
+    ns = sbench_measure(
+        [&]()
+        {
+            uint64_t sum = 0U;
+            soa.for_each_segment<2>(
+                [&](const uint32_t* qty, t_soa_queue::size_type n)
+                {
+                    for ( t_soa_queue::size_type i = 0U; i < n; i++ )
+                        sum = sum + qty[i];
+                });
+            SBENCH_KEEP(sum);
+        }, QUEUE_SIZE);
+    sbench_report("SoaSQueue qty column", ns);
+
+    ns = sbench_measure(
+        [&]()
+        {
+            uint64_t sum = 0U;
+            aos.for_each_segment(
+                [&](const t_trade* trades, t_aos_queue::size_type n)
+                {
+                    for ( t_aos_queue::size_type i = 0U; i < n; i++ )
+                        sum = sum + trades[i].qty;
+                });
+            SBENCH_KEEP(sum);
+        }, QUEUE_SIZE);
+    sbench_report("SQueue<t_trade> qty field", ns);
+
+    ns = sbench_measure(
+        [&]()
+        {
+            double max = 0.0;
+            soa.for_each_segment<1>(
+                [&](const double* price, t_soa_queue::size_type n)
+                {
+                    for ( t_soa_queue::size_type i = 0U; i < n; i++ )
+                        max = ( price[i] > max ) ? price[i] : max;
+                });
+            SBENCH_KEEP(max);
+        }, QUEUE_SIZE);
+    sbench_report("SoaSQueue price column (max)", ns);
+
+    ns = sbench_measure(
+        [&]()
+        {
+            double max = 0.0;
+            aos.for_each_segment(
+                [&](const t_trade* trades, t_aos_queue::size_type n)
+                {
+                    for ( t_aos_queue::size_type i = 0U; i < n; i++ )
+                        max = ( trades[i].price > max ) ? trades[i].price : max;
+                });
+            SBENCH_KEEP(max);
+        }, QUEUE_SIZE);
+    sbench_report("SQueue<t_trade> price field (max)", ns);
+
+    return 0;
+}
+
+/*****************************************************************************/
@@ -0,0 +1,152 @@
+/**
+ * @file    bench_statqueue.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    17-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Sliding window mean and standard deviation after each new sample:
+ * SStatQueue running statistics (O(1) per query) against a full rescan of
+ * the window of a plain SQueue (O(N) per query), for several window sizes.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2022 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ libraries
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+
+// Static Queue
+#include "squeue.hpp"
+#include "sstatqueue.hpp"
+
+// Benchmark helpers
+#include "sbench.hpp"
+
+/*****************************************************************************/
+
+/* Benchmark Configuration */
+
+/**
+ * @brief Number of samples pushed on each measure (to a full window).
+ */
+static const uint64_t SAMPLES = 16384U;
+
+/*****************************************************************************/
+
+/* Benchmark Helpers */
+
+/**
+ * @brief Sensor like sample: a slow ramp with some noise around 1000.
+ */
+static double sample(uint64_t i)
+{
+    return 1000.0 + (static_cast<double>(i % 512U) * 0.01) +
+            static_cast<double>((i * 2654435761U) % 97U) * 0.001;
+}
+
+/*****************************************************************************/
+
+/* Benchmark Cases */
+
+template <uint64_t WINDOW>
+static void run()
+{
+    static SStatQueue<double, WINDOW> stats;
+    static SQueue<double, WINDOW> plain;
+    double ns;
+
+    std::printf("\nWindow of %llu samples (ns per sample)\n",
+            static_cast<unsigned long long>(WINDOW));
+
+    ns = sbench_measure(
+        [&]()
+        {
+            stats.clear();
+            for ( uint64_t i = 0U; i < WINDOW; i++ )
+                stats.push(sample(i));
+        },
+        [&]()
+        {
+            for ( uint64_t i = 0U; i < SAMPLES; i++ )
+            {
+                stats.push(sample(i));
+                SBENCH_KEEP(stats.mean());
+                SBENCH_KEEP(stats.stddev());
+            }
+        }, SAMPLES);
+    sbench_report("SStatQueue running stats", ns);
+
+    ns = sbench_measure(
+        [&]()
+        {
+            plain.clear();
+            for ( uint64_t i = 0U; i < WINDOW; i++ )
+                plain.push(sample(i));
+        },
+        [&]()
+        {
+            for ( uint64_t i = 0U; i < SAMPLES; i++ )
+            {
+                double sum = 0.0;
+                double sum_sq = 0.0;
+                double mean;
+
+                plain.push(sample(i));
+                plain.for_each_segment(
+                    [&](const double* data, uint64_t n)
+                    {
+                        for ( uint64_t j = 0U; j < n; j++ )
+                            sum = sum + data[j];
+                    });
+                mean = sum / plain.size();
+                plain.for_each_segment(
+                    [&](const double* data, uint64_t n)
+                    {
+                        for ( uint64_t j = 0U; j < n; j++ )
+                            sum_sq = sum_sq +
+                                    ((data[j] - mean) * (data[j] - mean));
+                    });
+                SBENCH_KEEP(mean);
+                SBENCH_KEEP(std::sqrt(sum_sq / plain.size()));
+            }
+        }, SAMPLES);
+    sbench_report("SQueue two pass rescan", ns);
+}
+
+/*****************************************************************************/
+
+/* Main Function */
+
+int main()
+{
+    run<64U>();
+    run<1024U>();
+    run<16384U>();
+
+    return 0;
+}
+
+/*****************************************************************************/
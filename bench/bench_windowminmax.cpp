@@ -0,0 +1,164 @@
+/**
+ * @file    bench_windowminmax.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    17-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Sliding window minimum and maximum after each new sample of a random
+ * walk: SWindowMinMax (amortized O(1) per sample) against a scan of the
+ * SQueue window (O(N) per sample), at windows of 64, 4096 and 65536.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2022 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ libraries
+#include <cstdint>
+#include <cstdio>
+
+// Static Queue
+#include "squeue.hpp"
+#include "swindowminmax.hpp"
+
+// Benchmark helpers
+#include "sbench.hpp"
+
+/*****************************************************************************/
+
+/* Benchmark Configuration */
+
+/**
+ * @brief Number of samples pushed on each measure (to a full window).
+ */
+static const uint64_t SAMPLES = 8192U;
+
+/*****************************************************************************/
+
+/* Benchmark Helpers */
+
+/**
+ * @brief Random walk sample generator.
+ */
+struct t_walk
+{
+    uint32_t state = 12345U;
+    int32_t value = 0;
+
+    int32_t next()
+    {
+        state = (state * 1664525U) + 1013904223U;
+        value = value + static_cast<int32_t>(state >> 29) - 3;
+        return value;
+    }
+};
+
+/*****************************************************************************/
+
+/* Benchmark Cases */
+
+template <uint32_t WINDOW>
+static void run()
+{
+    static SQueue<int32_t, WINDOW> window;
+    static SWindowMinMax<int32_t, WINDOW> tracker;
+    t_walk walk;
+    double ns;
+
+    std::printf("\nWindow of %u samples, min and max after each sample "
+            "(ns per sample)\n", static_cast<unsigned>(WINDOW));
+
+    ns = sbench_measure(
+        [&]()
+        {
+            walk = t_walk();
+            window.clear();
+            tracker.clear();
+            for ( uint32_t i = 0U; i < WINDOW; i++ )
+            {
+                int32_t value = walk.next();
+                window.push(value);
+                tracker.push(value);
+            }
+        },
+        [&]()
+        {
+            for ( uint64_t i = 0U; i < SAMPLES; i++ )
+            {
+                int32_t value = walk.next();
+                window.push(value);
+                tracker.push(value);
+                SBENCH_KEEP(*(tracker.min()));
+                SBENCH_KEEP(*(tracker.max()));
+            }
+        }, SAMPLES);
+    sbench_report("SQueue + SWindowMinMax", ns);
+
+    ns = sbench_measure(
+        [&]()
+        {
+            walk = t_walk();
+            window.clear();
+            for ( uint32_t i = 0U; i < WINDOW; i++ )
+                window.push(walk.next());
+        },
+        [&]()
+        {
+            for ( uint64_t i = 0U; i < SAMPLES; i++ )
+            {
+                int32_t min = 0;
+                int32_t max = 0;
+
+                window.push(walk.next());
+                min = *(window.front());
+                max = min;
+                window.for_each_segment(
+                    [&](const int32_t* data, uint64_t n)
+                    {
+                        for ( uint64_t j = 0U; j < n; j++ )
+                        {
+                            min = ( data[j] < min ) ? data[j] : min;
+                            max = ( data[j] > max ) ? data[j] : max;
+                        }
+                    });
+                SBENCH_KEEP(min);
+                SBENCH_KEEP(max);
+            }
+        }, SAMPLES);
+    sbench_report("SQueue + window scan", ns);
+}
+
+/*****************************************************************************/
+
+/* Main Function */
+
+int main()
+{
+    run<64U>();
+    run<4096U>();
+    run<65536U>();
+
+    return 0;
+}
+
+/*****************************************************************************/
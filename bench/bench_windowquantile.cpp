@@ -0,0 +1,165 @@
+/**
+ * @file    bench_windowquantile.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    17-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Sliding window median and 95th percentile after each new sample:
+ * SWindowQuantile (O(log N) per sample) against std::nth_element on a copy
+ * of the SQueue window (O(N) per sample), for several window sizes.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2022 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ libraries
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+
+// Static Queue
+#include "squeue.hpp"
+#include "swindowquantile.hpp"
+
+// Benchmark helpers
+#include "sbench.hpp"
+
+/*****************************************************************************/
+
+/* Benchmark Configuration */
+
+/**
+ * @brief Number of samples pushed on each measure (to a full window).
+ */
+static const uint64_t SAMPLES = 2048U;
+
+/*****************************************************************************/
+
+/* Benchmark Helpers */
+
+/**
+ * @brief Noisy sample generator (latencies like values).
+ */
+struct t_samples
+{
+    uint32_t state = 12345U;
+
+    float next()
+    {
+        state = (state * 1664525U) + 1013904223U;
+        return 100.0f + static_cast<float>(state >> 20) * 0.01f;
+    }
+};
+
+/*****************************************************************************/
+
+/* Benchmark Cases */
+
+template <uint32_t WINDOW>
+static void run()
+{
+    static SQueue<float, WINDOW> window;
+    static SWindowQuantile<float, WINDOW> tracker;
+    static float copy[WINDOW];
+    t_samples samples;
+    double ns;
+
+    std::printf("\nWindow of %u samples, median and p95 after each sample "
+            "(ns per sample)\n", static_cast<unsigned>(WINDOW));
+
+    ns = sbench_measure(
+        [&]()
+        {
+            samples = t_samples();
+            window.clear();
+            tracker.clear();
+            for ( uint32_t i = 0U; i < WINDOW; i++ )
+            {
+                float value = samples.next();
+                window.push(value);
+                tracker.push(value);
+            }
+        },
+        [&]()
+        {
+            for ( uint64_t i = 0U; i < SAMPLES; i++ )
+            {
+                float value = samples.next();
+                window.push(value);
+                tracker.push(value);
+                SBENCH_KEEP(*(tracker.median()));
+                SBENCH_KEEP(*(tracker.quantile(0.95)));
+            }
+        }, SAMPLES);
+    sbench_report("SQueue + SWindowQuantile", ns);
+
+    ns = sbench_measure(
+        [&]()
+        {
+            samples = t_samples();
+            window.clear();
+            for ( uint32_t i = 0U; i < WINDOW; i++ )
+                window.push(samples.next());
+        },
+        [&]()
+        {
+            for ( uint64_t i = 0U; i < SAMPLES; i++ )
+            {
+                uint32_t n = 0U;
+                uint32_t median, p95;
+
+                window.push(samples.next());
+                window.for_each_segment(
+                    [&](const float* data, uint64_t count)
+                    {
+                        std::copy(data, data + count, copy + n);
+                        n = n + static_cast<uint32_t>(count);
+                    });
+
+                // Same nearest ranks than SWindowQuantile
+                median = (n - 1U) / 2U;
+                p95 = static_cast<uint32_t>((0.95 * n) + 0.999999) - 1U;
+                std::nth_element(copy, copy + p95, copy + n);
+                std::nth_element(copy, copy + median, copy + p95);
+                SBENCH_KEEP(copy[median]);
+                SBENCH_KEEP(copy[p95]);
+            }
+        }, SAMPLES);
+    sbench_report("SQueue + copy + std::nth_element", ns);
+}
+
+/*****************************************************************************/
+
+/* Main Function */
+
+int main()
+{
+    run<64U>();
+    run<1024U>();
+    run<16384U>();
+
+    return 0;
+}
+
+/*****************************************************************************/
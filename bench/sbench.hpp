@@ -0,0 +1,166 @@
+
+/**
+ * @file    sbench.hpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    17-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Minimal timing helpers for the SQueue benchmarks, so the benchmarks do
+ * not depend on any benchmark framework. Each measure runs the benchmark
+ * body several times and keeps the fastest run, to filter out the noise of
+ * other processes, and the results are printed as one line per case with
+ * the time per operation and the operations per second.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2022 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#ifndef STATIC_QUEUE_BENCH_H_
+#define STATIC_QUEUE_BENCH_H_
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ libraries
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+
+/*****************************************************************************/
+
+/* Build Configuration */
+
+/**
+ * @brief Number of runs of each measure (the fastest one is kept).
+ */
+#ifndef SBENCH_RUNS
+    #define SBENCH_RUNS 5
+#endif
+
+/**
+ * @brief Keep a value alive, so the compiler can not remove the code that
+ * computes it.
+ */
+#if defined(__GNUC__)
+    #define SBENCH_KEEP(value) \
+        __asm__ __volatile__("" : : "g"(value) : "memory")
+#else
+    #define SBENCH_KEEP(value) \
+        do { volatile auto sbench_sink = (value); (void)sbench_sink; } \
+        while ( 0 )
+#endif
+
+/*****************************************************************************/
+
+/* Timing Functions */
+
+/**
+ * @brief Get a monotonic time stamp.
+ *
+ * @return uint64_t Time stamp in nanoseconds.
+ */
+static inline uint64_t sbench_now_ns()
+{
+    return static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+/**
+ * @brief Measure the time per operation of a benchmark body, preparing its
+ * input before each run out of the measured time.
+ *
+ * @param setup Function to call as setup() before each run (i.e. to fill
+ * the Queues that the body consumes).
+ *
+ * @param body Function to call as body(), that does ops operations.
+ *
+ * @param ops Number of operations done by each body call.
+ *
+ * @return double Nanoseconds per operation of the fastest run.
+ */
+template <typename T_SETUP, typename T_BODY>
+double sbench_measure(T_SETUP setup, T_BODY body, uint64_t ops)
+{
+    double best = 0.0;
+
+    for ( int run = 0; run < SBENCH_RUNS; run++ )
+    {
+        uint64_t start;
+        double ns;
+
+        setup();
+        start = sbench_now_ns();
+        body();
+        ns = static_cast<double>(sbench_now_ns() - start) /
+                static_cast<double>(ops);
+        if ( (run == 0) || (ns < best) )
+            best = ns;
+    }
+
+    return best;
+}
+
+/**
+ * @brief Measure the time per operation of a benchmark body.
+ *
+ * @param body Function to call as body(), that does ops operations.
+ *
+ * @param ops Number of operations done by each body call.
+ *
+ * @return double Nanoseconds per operation of the fastest run.
+ */
+template <typename T_BODY>
+double sbench_measure(T_BODY body, uint64_t ops)
+{
+    return sbench_measure([]() {}, body, ops);
+}
+
+/**
+ * @brief Print the result of a benchmark case.
+ *
+ * @param name Case name.
+ *
+ * @param ns_per_op Nanoseconds per operation.
+ */
+static inline void sbench_report(const char* name, double ns_per_op)
+{
+    std::printf("%-48s %10.2f ns/op %12.2f Mop/s\n", name, ns_per_op,
+            ( ns_per_op > 0.0 ) ? (1000.0 / ns_per_op) : 0.0);
+}
+
+/**
+ * @brief Print the title of a group of benchmark cases.
+ *
+ * @param title Group title.
+ */
+static inline void sbench_title(const char* title)
+{
+    std::printf("\n%s\n", title);
+}
+
+/*****************************************************************************/
+
+#endif /* STATIC_QUEUE_BENCH_H_ */
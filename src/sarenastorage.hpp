@@ -0,0 +1,302 @@
+
+/**
+ * @file    sarenastorage.hpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    17-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * A minimal memory arena (a bump allocator over a caller provided block of
+ * memory) and a SQueue storage policy for runtime size Queues that gets its
+ * elements buffer from an arena, so the buffers of several Queues can be
+ * placed in a single preallocated region (i.e. a static array, a linker
+ * section or a shared memory mapping).
+ *
+ * The buffer is taken from the arena once, when the storage is constructed,
+ * so no memory allocation is done on the Queue hot path. The arena memory
+ * is never freed per Queue, the whole arena is reset at once, so the
+ * elements must be trivially destructible:
+ *
+ *     static uint8_t memory[1048576];
+ *     SQueueArena arena(memory, sizeof(memory));
+ *     SQueue<t_msg, SQUEUE_DYNAMIC_SIZE, SQueueArenaStorage> queue(
+ *             SQueueArenaStorage<t_msg, SQUEUE_DYNAMIC_SIZE>(arena, 1000));
+ *
+ * Two Queues must not share a buffer, so the storage (and a Queue that
+ * uses it) can be moved but not copied. A moved from storage has no buffer.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2022 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#ifndef STATIC_ARENA_STORAGE_H_
+#define STATIC_ARENA_STORAGE_H_
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ libraries
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+
+// Static Queue
+#include "squeue.hpp"
+
+/*****************************************************************************/
+
+/* Arena Interface */
+
+class SQueueArena
+{
+    public:
+
+        /* Public Methods */
+
+        /**
+         * @brief Construct a SQueueArena object over the given memory block.
+         *
+         * @param memory Memory block address.
+         *
+         * @param size Memory block size in bytes.
+         */
+        SQueueArena(void* memory, size_t size)
+        {
+            base = static_cast<uint8_t*>(memory);
+            arena_size = ( memory != nullptr ) ? size : 0U;
+            arena_used = 0U;
+        }
+
+        SQueueArena(const SQueueArena&) = delete;
+        SQueueArena& operator=(const SQueueArena&) = delete;
+
+        /**
+         * @brief Takes a block of memory from the arena.
+         *
+         * @param size Block size in bytes.
+         *
+         * @param alignment Block alignment (a power of two).
+         *
+         * @return void* Block address. If there is not enough free memory
+         * in the arena, a nullptr is returned.
+         */
+        void* allocate(size_t size, size_t alignment)
+        {
+            uintptr_t address = reinterpret_cast<uintptr_t>(base) +
+                    arena_used;
+            size_t padding = static_cast<size_t>(
+                    (alignment - (address & (alignment - 1U))) &
+                    (alignment - 1U));
+
+            if ( (padding > (arena_size - arena_used)) ||
+                 (size > (arena_size - arena_used - padding)) )
+                return nullptr;
+
+            arena_used = arena_used + padding + size;
+
+            return static_cast<void*>(base + (arena_used - size));
+        }
+
+        /**
+         * @brief Releases all the blocks taken from the arena.
+         *
+         * @details
+         * The Queues that use any of the released blocks must not be used
+         * anymore.
+         */
+        void reset()
+        {
+            arena_used = 0U;
+        }
+
+        /**
+         * @brief Returns the number of bytes taken from the arena.
+         *
+         * @return size_t Used bytes (including the alignment padding).
+         */
+        size_t used() const
+        {
+            return arena_used;
+        }
+
+        /**
+         * @brief Returns the number of free bytes of the arena.
+         *
+         * @return size_t Free bytes.
+         */
+        size_t available() const
+        {
+            return arena_size - arena_used;
+        }
+
+    /*********************************/
+
+    private:
+
+        /* Private Attributes */
+
+        /**
+         * @brief Memory block address.
+         */
+        uint8_t* base;
+
+        /**
+         * @brief Memory block size.
+         */
+        size_t arena_size;
+
+        /**
+         * @brief Number of bytes taken from the memory block.
+         */
+        size_t arena_used;
+};
+
+/*****************************************************************************/
+
+/* Class Interface */
+
+template <typename T_ELEMENTS, uint64_t STORAGE_SIZE>
+class SQueueArenaStorage
+{
+    static_assert(STORAGE_SIZE == SQUEUE_DYNAMIC_SIZE,
+            "Arena storage is only for runtime size Queues");
+    static_assert(std::is_trivially_destructible<T_ELEMENTS>::value,
+            "Arena storage requires trivially destructible elements");
+
+    public:
+
+        /* Public Methods */
+
+        /**
+         * @brief Construct a SQueueArenaStorage object, taking its buffer
+         * from the given arena.
+         *
+         * @param arena Arena to take the buffer from.
+         *
+         * @param size Minimum number of elements of the buffer (it is
+         * rounded up to a power of two).
+         */
+        SQueueArenaStorage(SQueueArena& arena, size_t size)
+        {
+            size_t count =
+                    SQueueIndex<SQUEUE_DYNAMIC_SIZE>::ceil_capacity(size);
+            void* block = nullptr;
+
+            if ( (count != 0U) &&
+                 (count <= (static_cast<size_t>(-1) / sizeof(T_ELEMENTS))) )
+                block = arena.allocate(count * sizeof(T_ELEMENTS),
+                        alignof(T_ELEMENTS));
+
+            elements = static_cast<T_ELEMENTS*>(block);
+            elements_count = ( block != nullptr ) ? count : 0U;
+            for ( size_t i = 0U; i < elements_count; i++ )
+                new (&(elements[i])) T_ELEMENTS();
+        }
+
+        /**
+         * @brief Construct a SQueueArenaStorage object taking the buffer of
+         * another one.
+         *
+         * @param other Storage to take the buffer from (it is left without
+         * buffer).
+         */
+        SQueueArenaStorage(SQueueArenaStorage&& other)
+        {
+            elements = other.elements;
+            elements_count = other.elements_count;
+            other.elements = nullptr;
+            other.elements_count = 0U;
+        }
+
+        /**
+         * @brief Take the buffer of another storage.
+         *
+         * @param other Storage to take the buffer from (it is left without
+         * buffer).
+         *
+         * @return SQueueArenaStorage& Reference to this storage.
+         */
+        SQueueArenaStorage& operator=(SQueueArenaStorage&& other)
+        {
+            if ( this != &other )
+            {
+                elements = other.elements;
+                elements_count = other.elements_count;
+                other.elements = nullptr;
+                other.elements_count = 0U;
+            }
+
+            return *this;
+        }
+
+        SQueueArenaStorage(const SQueueArenaStorage&) = delete;
+        SQueueArenaStorage& operator=(const SQueueArenaStorage&) = delete;
+
+        /**
+         * @brief Check if the buffer has been taken from the arena.
+         *
+         * @return true if the buffer can be used.
+         *
+         * @return false if the arena has not enough free memory (the Queue
+         * has capacity 0, it is always empty and rejects every push).
+         */
+        bool valid() const
+        {
+            return ( elements_count != 0U );
+        }
+
+        /**
+         * @brief Returns reference to the element at the given buffer
+         * position.
+         */
+        T_ELEMENTS& operator[](size_t i) { return elements[i]; }
+        const T_ELEMENTS& operator[](size_t i) const { return elements[i]; }
+
+        /**
+         * @brief Returns the number of elements of the buffer (a power of
+         * two).
+         */
+        size_t capacity() const { return elements_count; }
+
+    /*********************************/
+
+    private:
+
+        /* Private Attributes */
+
+        /**
+         * @brief Buffer first element address.
+         */
+        T_ELEMENTS* elements;
+
+        /**
+         * @brief Number of elements of the buffer.
+         */
+        size_t elements_count;
+};
+
+/*****************************************************************************/
+
+#endif /* STATIC_ARENA_STORAGE_H_ */
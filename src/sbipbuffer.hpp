@@ -0,0 +1,340 @@
+
+/**
+ * @file    sbipbuffer.hpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    17-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * A static memory allocated bipartite circular buffer (bip-buffer) of any
+ * kind of data type elements, that always gives contiguous blocks of
+ * elements both to write and to read, so a producer (i.e. a DMA transfer)
+ * can write a whole block of elements in place without splitting it at the
+ * end of the buffer.
+ *
+ * The implementation is based on two regions of the buffer: the region A,
+ * that grows towards the end of the buffer, and the region B, that is
+ * created at the start of the buffer when there is more free space before
+ * the region A than after it, and grows up to the region A start. The
+ * elements are read from the region A and, when it is empty, the region B
+ * becomes the new region A.
+ *
+ * Unlike SQueue, a write in a full buffer does not overwrite the oldest
+ * elements, the reservation is just rejected.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2022 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#ifndef STATIC_BIP_BUFFER_H_
+#define STATIC_BIP_BUFFER_H_
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ libraries
+#include <cstdint>
+
+/*****************************************************************************/
+
+/* Class Interface */
+
+template <typename T_ELEMENTS, uint32_t BUFFER_SIZE>
+class SBipBuffer
+{
+    public:
+
+        /* Public Methods */
+
+        /**
+         * @brief Construct a SBipBuffer object.
+         */
+        SBipBuffer()
+        {
+            clear();
+        }
+
+        /**
+         * @brief Clear the buffer.
+         */
+        void clear()
+        {
+            a_start = 0U;
+            a_end = 0U;
+            b_end = 0U;
+            b_active = false;
+            reserve_start = 0U;
+            reserve_size = 0U;
+            reserve_in_b = false;
+        }
+
+        /**
+         * @brief Check if the buffer is empty.
+         *
+         * @return true if the buffer is empty.
+         *
+         * @return false otherwise.
+         */
+        bool empty() const
+        {
+            return ( size() == 0U );
+        }
+
+        /**
+         * @brief Returns the number of committed elements in the buffer.
+         *
+         * @return uint32_t The number of elements.
+         */
+        uint32_t size() const
+        {
+            return (a_end - a_start) + b_end;
+        }
+
+        /**
+         * @brief Returns the largest number of elements that could be
+         * reserved now in a single block.
+         *
+         * @return uint32_t The largest reservation size.
+         */
+        uint32_t max_reserve() const
+        {
+            uint32_t after_a;
+
+            if ( b_active )
+                return a_start - b_end;
+
+            if ( a_start == a_end )
+                return BUFFER_SIZE;
+
+            after_a = BUFFER_SIZE - a_end;
+            return ( after_a >= a_start ) ? after_a : a_start;
+        }
+
+        /**
+         * @brief Reserves a contiguous block of elements to be written.
+         *
+         * @param n Number of elements to reserve.
+         *
+         * @return T_ELEMENTS* Address of the first element of the block. If
+         * there is not a free contiguous block of n elements, a nullptr is
+         * returned.
+         *
+         * @details
+         * The block is placed after the region A if it fits there, or at
+         * the start of the buffer (region B) otherwise. The elements are not
+         * available to be read until commit() is called. A new reservation
+         * replaces any previous uncommitted one.
+         */
+        T_ELEMENTS* reserve(uint32_t n)
+        {
+            reserve_size = 0U;
+
+            if ( (n == 0U) || (n > BUFFER_SIZE) )
+                return nullptr;
+
+            // Restart from the buffer start when empty to get the most space
+            if ( a_start == a_end )
+            {
+                a_start = 0U;
+                a_end = b_end;
+                b_end = 0U;
+                b_active = false;
+            }
+
+            if ( b_active )
+            {
+                if ( (a_start - b_end) < n )
+                    return nullptr;
+                reserve_start = b_end;
+                reserve_in_b = true;
+            }
+            else if ( (BUFFER_SIZE - a_end) >= n )
+            {
+                reserve_start = a_end;
+                reserve_in_b = false;
+            }
+            else if ( a_start >= n )
+            {
+                reserve_start = 0U;
+                reserve_in_b = true;
+            }
+            else
+                return nullptr;
+
+            reserve_size = n;
+
+            return &(buffer[reserve_start]);
+        }
+
+        /**
+         * @brief Makes available to be read the first elements of the block
+         * given by the last reserve() call.
+         *
+         * @param n Number of elements written, up to the reserved size (the
+         * rest of the reservation is released).
+         *
+         * @return true if the elements have been committed.
+         *
+         * @return false if there is no reservation or n is greater than the
+         * reserved size.
+         *
+         * @details
+         * The region A can be fully released between the reserve() and
+         * commit() calls, so the reservation is placed again relative to
+         * the current regions: a reservation in the region B that now
+         * follows the end of the region A (B has become A) or that starts an
+         * empty buffer extends the region A, and a reservation after an
+         * empty region A becomes the whole region A.
+         */
+        bool commit(uint32_t n)
+        {
+            if ( (reserve_size == 0U) || (n > reserve_size) )
+                return false;
+
+            if ( reserve_in_b &&
+                 ((b_end != reserve_start) || (a_start == a_end)) )
+                reserve_in_b = false;
+
+            if ( reserve_in_b )
+            {
+                b_end = reserve_start + n;
+                b_active = ( b_end > 0U );
+            }
+            else
+            {
+                if ( a_start == a_end )
+                    a_start = reserve_start;
+                a_end = reserve_start + n;
+            }
+
+            reserve_size = 0U;
+
+            return true;
+        }
+
+        /**
+         * @brief Returns the first contiguous block of elements to be read.
+         *
+         * @param n Output number of elements of the block.
+         *
+         * @return T_ELEMENTS* Address of the first element of the block,
+         * valid until the elements are released. If the buffer is empty, a
+         * nullptr is returned.
+         */
+        T_ELEMENTS* get_block(uint32_t* n)
+        {
+            if ( a_start == a_end )
+            {
+                *n = 0U;
+                return nullptr;
+            }
+
+            *n = a_end - a_start;
+
+            return &(buffer[a_start]);
+        }
+
+        /**
+         * @brief Removes elements from the start of the block given by
+         * get_block().
+         *
+         * @param n Number of elements to remove (limited to the block size).
+         *
+         * @details
+         * When the region A is fully read, the region B (if any) becomes the
+         * new region A.
+         */
+        void release(uint32_t n)
+        {
+            if ( n > (a_end - a_start) )
+                n = a_end - a_start;
+
+            a_start = a_start + n;
+            if ( a_start != a_end )
+                return;
+
+            if ( b_active )
+            {
+                a_start = 0U;
+                a_end = b_end;
+                b_end = 0U;
+                b_active = false;
+            }
+            else
+            {
+                a_start = 0U;
+                a_end = 0U;
+            }
+        }
+
+    /*********************************/
+
+    private:
+
+        /* Private Attributes */
+
+        /**
+         * @brief Internal buffer to store the elements.
+         */
+        T_ELEMENTS buffer[BUFFER_SIZE];
+
+        /**
+         * @brief Region A first element index.
+         */
+        uint32_t a_start;
+
+        /**
+         * @brief Region A end index (one past its last element).
+         */
+        uint32_t a_end;
+
+        /**
+         * @brief Region B end index (the region starts at index 0).
+         */
+        uint32_t b_end;
+
+        /**
+         * @brief Region B is in use.
+         */
+        bool b_active;
+
+        /**
+         * @brief Reserved block first element index.
+         */
+        uint32_t reserve_start;
+
+        /**
+         * @brief Reserved block size (0 if there is no reservation).
+         */
+        uint32_t reserve_size;
+
+        /**
+         * @brief Reserved block is placed in the region B.
+         */
+        bool reserve_in_b;
+};
+
+/*****************************************************************************/
+
+#endif /* STATIC_BIP_BUFFER_H_ */
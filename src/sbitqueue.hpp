@@ -0,0 +1,500 @@
+
+/**
+ * @file    sbitqueue.hpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    17-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * A static memory allocated Queue of small unsigned values (flags or small
+ * states of 1, 2 or 4 bits each) that packs the elements in 32 bits words,
+ * so it needs 8, 4 or 2 times less memory than a SQueue of bool or uint8_t
+ * elements of the same size.
+ *
+ * The head and tail indexes behave exactly like the SQueue ones (a push in
+ * a full Queue overwrites the oldest element). Besides the element access,
+ * it provides bulk operations (count and find of a value) that compare all
+ * the elements of a word at once, using the usual SWAR (SIMD within a
+ * register) bit tricks and the popcount and count trailing zeros
+ * instructions.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2022 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#ifndef STATIC_BIT_QUEUE_H_
+#define STATIC_BIT_QUEUE_H_
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ libraries
+#include <cstdint>
+
+// Static Queue
+#include "squeue.hpp"
+
+/*****************************************************************************/
+
+/* Class Interface */
+
+template <uint32_t ELEMENT_BITS, uint64_t QUEUE_SIZE>
+class SBitQueue
+{
+    static_assert((ELEMENT_BITS == 1U) || (ELEMENT_BITS == 2U) ||
+            (ELEMENT_BITS == 4U), "Bit Queue elements must be 1, 2 or 4 bits");
+    static_assert(QUEUE_SIZE > 0U, "Queue size must be greater than 0");
+
+    public:
+
+        /* Public Types */
+
+        typedef SQueueIndex<QUEUE_SIZE> t_index;
+        typedef typename t_index::size_type size_type;
+        typedef typename t_index::index_type index_type;
+
+        /* Public Methods */
+
+        /**
+         * @brief Construct a SBitQueue object.
+         */
+        SBitQueue()
+        {
+            clear();
+        }
+
+        /**
+         * @brief Clear the Queue (zeroing the buffer words, as each push
+         * writes just the bits of its element).
+         */
+        void clear()
+        {
+            for ( uint64_t i = 0U; i < NUM_WORDS; i++ )
+                words[i] = 0U;
+            queue_head = 0U;
+            queue_tail = 0U;
+            buffer_overflow = false;
+        }
+
+        /**
+         * @brief Check if the Queue is empty (no elements in the buffer).
+         *
+         * @return true if the Queue is empty.
+         *
+         * @return false otherwise.
+         */
+        bool empty() const
+        {
+            return ( queue_head == queue_tail );
+        }
+
+        /**
+         * @brief Returns the number of elements currently stored in the Queue.
+         *
+         * @return size_type The number of elements in the Queue.
+         */
+        size_type size() const
+        {
+            return t_index::distance(queue_tail, queue_head);
+        }
+
+        /**
+         * @brief Pushes the given value to the end of the Queue.
+         *
+         * @param value The value to push (only its ELEMENT_BITS lower bits
+         * are stored).
+         *
+         * @return t_overflow BUFFER_OVERFLOW if the oldest element has been
+         * overwritten, BUFFER_OK otherwise.
+         */
+        t_overflow push(uint8_t value)
+        {
+            if ( size() >= QUEUE_SIZE )
+            {
+                buffer_overflow = true;
+                queue_tail = static_cast<index_type>(
+                        t_index::advance(queue_tail, 1U));
+            }
+
+            queue_head = static_cast<index_type>(
+                    t_index::advance(queue_head, 1U));
+            set(t_index::slot(queue_head), value);
+
+            if ( buffer_overflow )
+                return BUFFER_OVERFLOW;
+            else
+                return BUFFER_OK;
+        }
+
+        /**
+         * @brief Removes an element from the front of the Queue. If the Queue
+         * is empty, do nothing.
+         * Note: Any element pop will clear the queue overflow flag.
+         */
+        void pop()
+        {
+            if ( empty() )
+                return;
+
+            queue_tail = static_cast<index_type>(
+                    t_index::advance(queue_tail, 1U));
+            buffer_overflow = false;
+        }
+
+        /**
+         * @brief Returns the value of the element at the given position,
+         * counting from the front of the Queue.
+         *
+         * @param i Position of the element from the Queue front.
+         *
+         * @return uint8_t The element value.
+         *
+         * @details
+         * This function does not check the position against the number of
+         * stored elements.
+         */
+        uint8_t operator[](size_type i) const
+        {
+            return get(element_index(i));
+        }
+
+        /**
+         * @brief Returns the value of the first element in the Queue.
+         *
+         * @return uint8_t The element value (0 if the Queue is empty).
+         */
+        uint8_t front() const
+        {
+            if ( empty() )
+                return 0U;
+
+            return get(element_index(0U));
+        }
+
+        /**
+         * @brief Returns the value of the last element in the Queue.
+         *
+         * @return uint8_t The element value (0 if the Queue is empty).
+         */
+        uint8_t back() const
+        {
+            if ( empty() )
+                return 0U;
+
+            return get(t_index::slot(queue_head));
+        }
+
+        /**
+         * @brief Returns the number of elements of the Queue with the given
+         * value (i.e. the number of true flags for 1 bit elements).
+         *
+         * @param value The value to count.
+         *
+         * @return size_type The number of elements with that value.
+         */
+        size_type count(uint8_t value) const
+        {
+            size_type result = 0U;
+
+            scan(0U, value,
+                [&](size_type, uint32_t matches)
+                {
+                    result = result + popcount(matches);
+                    return false;
+                });
+
+            return result;
+        }
+
+        /**
+         * @brief Returns the position (counting from the Queue front) of the
+         * first element with the given value, starting from a position.
+         *
+         * @param value The value to find.
+         *
+         * @param from Position of the first element to check.
+         *
+         * @return size_type The element position, or size() if there is no
+         * element with that value.
+         */
+        size_type find(uint8_t value, size_type from = 0U) const
+        {
+            size_type result = size();
+
+            scan(from, value,
+                [&](size_type position, uint32_t matches)
+                {
+                    result = position + (ctz(matches) / ELEMENT_BITS);
+                    return true;
+                });
+
+            return result;
+        }
+
+    /*********************************/
+
+    private:
+
+        /* Private Constants */
+
+        /**
+         * @brief Number of elements in a word.
+         */
+        static const uint32_t WORD_ELEMENTS = 32U / ELEMENT_BITS;
+
+        /**
+         * @brief Number of words of the buffer.
+         */
+        static const uint64_t NUM_WORDS =
+                (QUEUE_SIZE + WORD_ELEMENTS - 1U) / WORD_ELEMENTS;
+
+        /**
+         * @brief Mask of the bits of an element value.
+         */
+        static const uint32_t VALUE_MASK = (1U << ELEMENT_BITS) - 1U;
+
+        /**
+         * @brief Mask of the lowest bit of each element of a word.
+         */
+        static const uint32_t LOW_BITS = ( ELEMENT_BITS == 1U ) ?
+                0xFFFFFFFFU : (( ELEMENT_BITS == 2U ) ?
+                0x55555555U : 0x11111111U);
+
+        /* Private Attributes */
+
+        /**
+         * @brief Internal buffer to store the packed Queue elements.
+         */
+        uint32_t words[NUM_WORDS];
+
+        /**
+         * @brief Queue circular buffer head location index.
+         */
+        index_type queue_head;
+
+        /**
+         * @brief Queue circular buffer tail location index.
+         */
+        index_type queue_tail;
+
+        /**
+         * @brief Queue is full and has been overflowed.
+         */
+        bool buffer_overflow;
+
+        /******************************/
+
+        /* Private Methods */
+
+        /**
+         * @brief Get the buffer position of an element from its position
+         * counting from the Queue front.
+         * @param i Position of the element from the Queue front.
+         * @return size_type The buffer position of the element.
+         */
+        size_type element_index(size_type i) const
+        {
+            return t_index::slot(t_index::advance(queue_tail, i + 1U));
+        }
+
+        /**
+         * @brief Get an element value from the buffer.
+         * @param slot Buffer position of the element.
+         * @return uint8_t The element value.
+         */
+        uint8_t get(size_type slot) const
+        {
+            uint32_t shift = (slot % WORD_ELEMENTS) * ELEMENT_BITS;
+            return static_cast<uint8_t>(
+                    (words[slot / WORD_ELEMENTS] >> shift) & VALUE_MASK);
+        }
+
+        /**
+         * @brief Set an element value in the buffer.
+         * @param slot Buffer position of the element.
+         * @param value The element value.
+         */
+        void set(size_type slot, uint8_t value)
+        {
+            uint32_t shift = (slot % WORD_ELEMENTS) * ELEMENT_BITS;
+            uint32_t& word = words[slot / WORD_ELEMENTS];
+
+            word = (word & ~(VALUE_MASK << shift)) |
+                    ((static_cast<uint32_t>(value) & VALUE_MASK) << shift);
+        }
+
+        /**
+         * @brief Count the bits set in a word.
+         * @param x The word.
+         * @return uint32_t The number of bits set.
+         */
+        static uint32_t popcount(uint32_t x)
+        {
+        #if defined(__GNUC__)
+            return static_cast<uint32_t>(__builtin_popcount(x));
+        #else
+            x = x - ((x >> 1) & 0x55555555U);
+            x = (x & 0x33333333U) + ((x >> 2) & 0x33333333U);
+            x = (x + (x >> 4)) & 0x0F0F0F0FU;
+            return (x * 0x01010101U) >> 24;
+        #endif
+        }
+
+        /**
+         * @brief Count the trailing zero bits of a non zero word.
+         * @param x The word.
+         * @return uint32_t The number of trailing zeros.
+         */
+        static uint32_t ctz(uint32_t x)
+        {
+        #if defined(__GNUC__)
+            return static_cast<uint32_t>(__builtin_ctz(x));
+        #else
+            uint32_t n = 0U;
+            while ( (x & 1U) == 0U )
+            {
+                x = x >> 1;
+                n = n + 1U;
+            }
+            return n;
+        #endif
+        }
+
+        /**
+         * @brief Get the mask of the elements of a word equal to a value.
+         * @param word The word.
+         * @param pattern The value replicated in all the elements of a word.
+         * @return uint32_t Mask with the lowest bit of each matching element
+         * set.
+         * @details
+         * The elements equal to the value are zero after a XOR with the
+         * pattern, so the bits of each element are ORed into its lowest bit,
+         * which is then cleared for the matching elements.
+         */
+        static uint32_t match(uint32_t word, uint32_t pattern)
+        {
+            uint32_t x = word ^ pattern;
+
+            if ( ELEMENT_BITS >= 2U )
+                x = x | (x >> 1);
+            if ( ELEMENT_BITS >= 4U )
+                x = x | (x >> 2);
+
+            return ~x & LOW_BITS;
+        }
+
+        /**
+         * @brief Get the mask of the lowest bits of the elements of a word
+         * in a range of element positions.
+         * @param first First element position in the word.
+         * @param last Element position after the last one (up to
+         * WORD_ELEMENTS).
+         * @return uint32_t Mask with the lowest bit of the elements set.
+         */
+        static uint32_t range_mask(uint32_t first, uint32_t last)
+        {
+            uint32_t high = ( last >= WORD_ELEMENTS ) ? 0xFFFFFFFFU :
+                    ((1U << (last * ELEMENT_BITS)) - 1U);
+            uint32_t low = (1U << (first * ELEMENT_BITS)) - 1U;
+
+            return high & ~low & LOW_BITS;
+        }
+
+        /**
+         * @brief Compare the elements from a position to the Queue back with
+         * a value, a whole word at a time.
+         * @param from Position of the first element to compare.
+         * @param value The value to compare.
+         * @param f Function to call as f(position, matches) for each word
+         * with any matching element, where position is the Queue position
+         * of the word lowest element and matches the mask returned by
+         * match(). The scan stops when the function returns true.
+         * @details
+         * The elements from the position to the back can wrap around the
+         * end of the buffer, so they are split in two ranges of buffer
+         * positions.
+         */
+        template <typename T_FUNCTION>
+        void scan(size_type from, uint8_t value, T_FUNCTION f) const
+        {
+            size_type n, first, first_count;
+            uint32_t pattern = (static_cast<uint32_t>(value) & VALUE_MASK) *
+                    LOW_BITS;
+
+            if ( from >= size() )
+                return;
+
+            n = size() - from;
+            first = element_index(from);
+            first_count = QUEUE_SIZE - first;
+            if ( first_count >= n )
+            {
+                scan_range(first, first + n, from - first, pattern, f);
+                return;
+            }
+
+            if ( scan_range(first, QUEUE_SIZE, from - first, pattern, f) )
+                return;
+            scan_range(0U, n - first_count, from + first_count, pattern, f);
+        }
+
+        /**
+         * @brief Compare a range of buffer positions with a value, a whole
+         * word at a time.
+         * @param begin First buffer position.
+         * @param end Buffer position after the last one.
+         * @param offset Value to add to a buffer position to get its Queue
+         * position (modulo the size type range).
+         * @param pattern The value replicated in all the elements of a word.
+         * @param f Function to call for each word with any match.
+         * @return true if the function has stopped the scan.
+         */
+        template <typename T_FUNCTION>
+        bool scan_range(size_type begin, size_type end, size_type offset,
+                uint32_t pattern, T_FUNCTION& f) const
+        {
+            size_type w = begin / WORD_ELEMENTS;
+            size_type last_w = (end - 1U) / WORD_ELEMENTS;
+
+            for ( ; w <= last_w; w++ )
+            {
+                size_type base = w * WORD_ELEMENTS;
+                uint32_t lo = ( base < begin ) ?
+                        static_cast<uint32_t>(begin - base) : 0U;
+                uint32_t hi = ( (end - base) < WORD_ELEMENTS ) ?
+                        static_cast<uint32_t>(end - base) : WORD_ELEMENTS;
+                uint32_t matches = match(words[w], pattern) &
+                        range_mask(lo, hi);
+
+                if ( (matches != 0U) && f(base + offset, matches) )
+                    return true;
+            }
+
+            return false;
+        }
+};
+
+/*****************************************************************************/
+
+#endif /* STATIC_BIT_QUEUE_H_ */
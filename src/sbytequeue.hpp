@@ -0,0 +1,403 @@
+
+/**
+ * @file    sbytequeue.hpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    17-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * A static memory allocated Queue of variable length records (messages),
+ * stored in a circular buffer of bytes without any kind of dynamic memory
+ * allocation, as a companion of SQueue for messages whose size is not
+ * fixed.
+ *
+ * Each record is stored contiguously as a 4 bytes length header followed by
+ * the record data, padded to a 4 bytes boundary. When a record does not fit
+ * between the current write position and the end of the buffer, a skip
+ * marker is written at that position and the record is placed at the start
+ * of the buffer, so a record is never split. This allows to reserve the
+ * space of a record and write it in place (try_write() and commit()), and
+ * to read a record in place (front() and pop()), without any copy.
+ *
+ * Unlike SQueue, a write in a full Queue does not overwrite the oldest
+ * records (they could have a different size), so the write is rejected.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2022 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#ifndef STATIC_BYTE_QUEUE_H_
+#define STATIC_BYTE_QUEUE_H_
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ libraries
+#include <cstdint>
+#include <cstring>
+
+/*****************************************************************************/
+
+/* Class Interface */
+
+template <uint32_t BUFFER_SIZE>
+class SByteQueue
+{
+    static_assert((BUFFER_SIZE >= 8U) && ((BUFFER_SIZE % 4U) == 0U),
+            "Byte Queue size must be a multiple of 4 bytes");
+
+    public:
+
+        /* Public Methods */
+
+        /**
+         * @brief Construct a SByteQueue object.
+         */
+        SByteQueue()
+        {
+            clear();
+        }
+
+        /**
+         * @brief Clear the Queue.
+         */
+        void clear()
+        {
+            read_pos = 0U;
+            write_pos = 0U;
+            used_bytes = 0U;
+            num_records = 0U;
+            reserved_pos = 0U;
+            reserved_size = 0U;
+            reserved_skip = false;
+            reserved = false;
+        }
+
+        /**
+         * @brief Check if the Queue is empty (no records in the buffer).
+         *
+         * @return true if the Queue is empty.
+         *
+         * @return false otherwise.
+         */
+        bool empty() const
+        {
+            return ( num_records == 0U );
+        }
+
+        /**
+         * @brief Returns the number of records currently stored in the Queue.
+         *
+         * @return uint32_t The number of records in the Queue.
+         */
+        uint32_t size() const
+        {
+            return num_records;
+        }
+
+        /**
+         * @brief Returns the number of buffer bytes in use, including the
+         * records headers, padding and skipped bytes.
+         *
+         * @return uint32_t The number of used bytes.
+         */
+        uint32_t used() const
+        {
+            return used_bytes;
+        }
+
+        /**
+         * @brief Returns the largest record size that could ever be stored.
+         *
+         * @return uint32_t Maximum record size in bytes.
+         */
+        static uint32_t max_record_size()
+        {
+            return BUFFER_SIZE - HEADER_SIZE;
+        }
+
+        /**
+         * @brief Reserves a contiguous space for a new record at the end of
+         * the Queue.
+         *
+         * @param size Number of bytes to reserve.
+         *
+         * @return uint8_t* Address where the record data must be written. If
+         * there is not enough free contiguous space, a nullptr is returned.
+         *
+         * @details
+         * The record is not added to the Queue until commit() is called. A
+         * new reservation replaces any previous uncommitted one.
+         */
+        uint8_t* try_write(uint32_t size)
+        {
+            uint32_t total;
+
+            reserved = false;
+            if ( size > max_record_size() )
+                return nullptr;
+            total = record_bytes(size);
+
+            // Restart from the buffer start when empty to get the most space
+            if ( used_bytes == 0U )
+            {
+                read_pos = 0U;
+                write_pos = 0U;
+            }
+
+            reserved_skip = false;
+            if ( (used_bytes != 0U) && (write_pos <= read_pos) )
+            {
+                // Data wraps around, the free space is between both positions
+                if ( total > (read_pos - write_pos) )
+                    return nullptr;
+                reserved_pos = write_pos;
+            }
+            else if ( total <= (BUFFER_SIZE - write_pos) )
+                reserved_pos = write_pos;
+            else if ( total <= read_pos )
+            {
+                // Free space at the end is too small, skip it
+                reserved_pos = 0U;
+                reserved_skip = true;
+            }
+            else
+                return nullptr;
+
+            reserved_size = size;
+            reserved = true;
+
+            return &(buffer[reserved_pos + HEADER_SIZE]);
+        }
+
+        /**
+         * @brief Adds the record reserved by the last try_write() call to
+         * the end of the Queue.
+         *
+         * @param size Final number of bytes of the record, that can be lower
+         * than the reserved size.
+         *
+         * @return true if the record has been added.
+         *
+         * @return false if there is no reservation or the size is greater
+         * than the reserved one.
+         */
+        bool commit(uint32_t size)
+        {
+            if ( !reserved || (size > reserved_size) )
+                return false;
+
+            // The records before the skipped space could be already popped
+            if ( reserved_skip && (num_records == 0U) )
+                read_pos = 0U;
+            else if ( reserved_skip )
+            {
+                used_bytes = used_bytes + (BUFFER_SIZE - write_pos);
+                write_header(write_pos, SKIP_MARKER);
+            }
+
+            write_header(reserved_pos, size);
+            write_pos = reserved_pos + record_bytes(size);
+            if ( write_pos >= BUFFER_SIZE )
+                write_pos = 0U;
+            used_bytes = used_bytes + record_bytes(size);
+            num_records = num_records + 1U;
+            reserved = false;
+
+            return true;
+        }
+
+        /**
+         * @brief Pushes a copy of the given record to the end of the Queue.
+         *
+         * @param data Record data.
+         *
+         * @param size Record size in bytes.
+         *
+         * @return true if the record has been added.
+         *
+         * @return false if there is not enough free space.
+         */
+        bool push(const void* data, uint32_t size)
+        {
+            uint8_t* record = try_write(size);
+
+            if ( record == nullptr )
+                return false;
+
+            memcpy(record, data, size);
+
+            return commit(size);
+        }
+
+        /**
+         * @brief Returns the first record in the Queue (the oldest one).
+         *
+         * @param size Output number of bytes of the record.
+         *
+         * @return const uint8_t* Address of the record data, valid until the
+         * record is removed with pop(). If there is no records on the Queue,
+         * a nullptr is returned.
+         */
+        const uint8_t* front(uint32_t* size) const
+        {
+            if ( empty() )
+                return nullptr;
+
+            *size = read_header(read_pos);
+
+            return &(buffer[read_pos + HEADER_SIZE]);
+        }
+
+        /**
+         * @brief Removes a record from the front of the Queue. If the Queue
+         * is empty, do nothing.
+         */
+        void pop()
+        {
+            uint32_t total;
+
+            if ( empty() )
+                return;
+
+            total = record_bytes(read_header(read_pos));
+            read_pos = read_pos + total;
+            used_bytes = used_bytes - total;
+            num_records = num_records - 1U;
+
+            // Jump over the end of the buffer to the next record
+            if ( read_pos >= BUFFER_SIZE )
+                read_pos = 0U;
+            else if ( (num_records > 0U) &&
+                      (read_header(read_pos) == SKIP_MARKER) )
+            {
+                used_bytes = used_bytes - (BUFFER_SIZE - read_pos);
+                read_pos = 0U;
+            }
+        }
+
+    /*********************************/
+
+    private:
+
+        /* Private Constants */
+
+        /**
+         * @brief Record header (length) size.
+         */
+        static const uint32_t HEADER_SIZE = 4U;
+
+        /**
+         * @brief Header value that marks the end of the buffer as unused.
+         */
+        static const uint32_t SKIP_MARKER = 0xFFFFFFFFU;
+
+        /* Private Attributes */
+
+        /**
+         * @brief Internal buffer to store the records.
+         */
+        alignas(4) uint8_t buffer[BUFFER_SIZE];
+
+        /**
+         * @brief Buffer position of the first record header.
+         */
+        uint32_t read_pos;
+
+        /**
+         * @brief Buffer position for the next record header.
+         */
+        uint32_t write_pos;
+
+        /**
+         * @brief Number of buffer bytes in use.
+         */
+        uint32_t used_bytes;
+
+        /**
+         * @brief Number of records stored in the buffer.
+         */
+        uint32_t num_records;
+
+        /**
+         * @brief Buffer position of the reserved record header.
+         */
+        uint32_t reserved_pos;
+
+        /**
+         * @brief Reserved record size.
+         */
+        uint32_t reserved_size;
+
+        /**
+         * @brief There is a record reservation pending to commit.
+         */
+        bool reserved;
+
+        /**
+         * @brief Reserved record requires to skip the end of the buffer.
+         */
+        bool reserved_skip;
+
+        /******************************/
+
+        /* Private Methods */
+
+        /**
+         * @brief Get the buffer bytes used by a record, including its header
+         * and padding.
+         * @param size Record size.
+         * @return uint32_t Record total bytes.
+         */
+        static uint32_t record_bytes(uint32_t size)
+        {
+            return (HEADER_SIZE + size + 3U) & ~3U;
+        }
+
+        /**
+         * @brief Write a record header.
+         * @param pos Header buffer position.
+         * @param value Header value.
+         */
+        void write_header(uint32_t pos, uint32_t value)
+        {
+            memcpy(&(buffer[pos]), &value, HEADER_SIZE);
+        }
+
+        /**
+         * @brief Read a record header.
+         * @param pos Header buffer position.
+         * @return uint32_t Header value.
+         */
+        uint32_t read_header(uint32_t pos) const
+        {
+            uint32_t value;
+            memcpy(&value, &(buffer[pos]), HEADER_SIZE);
+            return value;
+        }
+};
+
+/*****************************************************************************/
+
+#endif /* STATIC_BYTE_QUEUE_H_ */
@@ -0,0 +1,377 @@
+
+/**
+ * @file    sdrrqueue.hpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    17-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * A static memory allocated Queue composed of several SQueue lanes (i.e.
+ * one per tenant or flow) that dequeues the elements with the deficit
+ * round robin scheduling algorithm, so each non empty lane gets a share of
+ * the dequeues proportional to its weight, and no lane can starve the
+ * other ones.
+ *
+ * The non empty lanes are kept in an active list (a SQueue of lane
+ * numbers). On each turn of the front active lane, its weight is added to
+ * its deficit counter, and its elements are dequeued while the cost of the
+ * front element is not greater than the deficit, which is reduced by that
+ * cost. Then the lane goes to the end of the active list. A lane that gets
+ * empty leaves the active list and loses its remaining deficit.
+ *
+ * The cost of an element is given by the cost function template
+ * parameter, so the weights can be expressed in elements (the default
+ * SDrrUnitCost, where each element costs 1) or in bytes (a cost function
+ * that returns the element size). The dequeue is O(1) when the weights
+ * are not lower than the maximum element cost, as a lane turn never ends
+ * without serving at least one element.
+ *
+ * As in SQueue, a push in a full lane overwrites its oldest element.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2022 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#ifndef STATIC_DRR_QUEUE_H_
+#define STATIC_DRR_QUEUE_H_
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ libraries
+#include <cstdint>
+
+// Static Queue
+#include "squeue.hpp"
+
+/*****************************************************************************/
+
+/* Data Types */
+
+/**
+ * @brief Default cost function of SDrrQueue, each element costs 1 (weights
+ * in elements).
+ */
+struct SDrrUnitCost
+{
+    template <typename T_ELEMENT>
+    uint32_t operator()(const T_ELEMENT&) const
+    {
+        return 1U;
+    }
+};
+
+/*****************************************************************************/
+
+/* Class Interface */
+
+template <typename T_QUEUE_ELEMENTS, uint32_t LANE_SIZE, uint32_t NUM_LANES,
+        typename T_COST = SDrrUnitCost>
+class SDrrQueue
+{
+    static_assert(NUM_LANES > 0U, "DRR Queue must have at least one lane");
+
+    public:
+
+        /* Public Methods */
+
+        /**
+         * @brief Construct a SDrrQueue object, with all the lanes weights
+         * set to 1.
+         *
+         * @param cost Cost function object.
+         */
+        explicit SDrrQueue(const T_COST& cost = T_COST()) :
+            element_cost(cost)
+        {
+            for ( uint32_t i = 0U; i < NUM_LANES; i++ )
+                weights[i] = 1U;
+            clear();
+        }
+
+        /**
+         * @brief Clear all the lanes and served counters (the weights are
+         * kept).
+         */
+        void clear()
+        {
+            for ( uint32_t i = 0U; i < NUM_LANES; i++ )
+            {
+                lanes[i].clear();
+                deficits[i] = 0U;
+                active_lane[i] = false;
+                served[i] = 0U;
+                served_costs[i] = 0U;
+            }
+            active.clear();
+            turn_started = false;
+        }
+
+        /**
+         * @brief Sets the weight of a lane (the deficit added to the lane on
+         * each of its turns).
+         *
+         * @param lane Lane number.
+         *
+         * @param weight Lane weight, in cost units (0 is taken as 1).
+         *
+         * @return true if the weight has been set.
+         *
+         * @return false if the lane number is out of range.
+         */
+        bool set_weight(uint32_t lane, uint32_t weight)
+        {
+            if ( lane >= NUM_LANES )
+                return false;
+
+            weights[lane] = ( weight == 0U ) ? 1U : weight;
+
+            return true;
+        }
+
+        /**
+         * @brief Check if all the lanes are empty.
+         *
+         * @return true if the Queue is empty.
+         *
+         * @return false otherwise.
+         */
+        bool empty() const
+        {
+            return active.empty();
+        }
+
+        /**
+         * @brief Returns reference to a lane (i.e. to check its size).
+         *
+         * @param lane Lane number.
+         *
+         * @return const SQueue* Reference to the lane. If the lane number is
+         * out of range, a nullptr is returned.
+         */
+        const SQueue<T_QUEUE_ELEMENTS, LANE_SIZE>* lane(uint32_t lane) const
+        {
+            if ( lane >= NUM_LANES )
+                return nullptr;
+
+            return &(lanes[lane]);
+        }
+
+        /**
+         * @brief Returns the number of elements dequeued from a lane.
+         *
+         * @param lane Lane number.
+         *
+         * @return uint64_t The number of served elements (0 if the lane
+         * number is out of range).
+         */
+        uint64_t served_count(uint32_t lane) const
+        {
+            if ( lane >= NUM_LANES )
+                return 0U;
+
+            return served[lane];
+        }
+
+        /**
+         * @brief Returns the total cost of the elements dequeued from a lane
+         * (i.e. the served bytes with a bytes cost function).
+         *
+         * @param lane Lane number.
+         *
+         * @return uint64_t The served cost (0 if the lane number is out of
+         * range).
+         */
+        uint64_t served_cost(uint32_t lane) const
+        {
+            if ( lane >= NUM_LANES )
+                return 0U;
+
+            return served_costs[lane];
+        }
+
+        /**
+         * @brief Pushes the given element value to the end of a lane.
+         *
+         * @param lane Lane number.
+         *
+         * @param element The value of the element to push.
+         *
+         * @return t_overflow BUFFER_OVERFLOW if the oldest element of the
+         * lane has been overwritten or the lane number is out of range (the
+         * element is discarded), BUFFER_OK otherwise.
+         */
+        t_overflow push(uint32_t lane, const T_QUEUE_ELEMENTS& element)
+        {
+            if ( lane >= NUM_LANES )
+                return BUFFER_OVERFLOW;
+
+            if ( !active_lane[lane] )
+            {
+                active.push(lane);
+                active_lane[lane] = true;
+            }
+
+            return lanes[lane].push(element);
+        }
+
+        /**
+         * @brief Returns reference to the next element to be dequeued.
+         *
+         * @return T_QUEUE_ELEMENTS* Reference to the element. If there is no
+         * elements on the Queue, a nullptr is returned.
+         *
+         * @details
+         * The lane turns are advanced up to the lane of the next element.
+         */
+        T_QUEUE_ELEMENTS* front()
+        {
+            uint32_t lane = select();
+
+            if ( lane >= NUM_LANES )
+                return nullptr;
+
+            return lanes[lane].front();
+        }
+
+        /**
+         * @brief Removes the next element to be dequeued, charging its cost
+         * to its lane. If the Queue is empty, do nothing.
+         */
+        void pop()
+        {
+            uint32_t lane = select();
+            uint32_t cost;
+
+            if ( lane >= NUM_LANES )
+                return;
+
+            cost = element_cost(*(lanes[lane].front()));
+            deficits[lane] = deficits[lane] - cost;
+            served[lane] = served[lane] + 1U;
+            served_costs[lane] = served_costs[lane] + cost;
+            lanes[lane].pop();
+
+            if ( lanes[lane].empty() )
+            {
+                // Empty lanes do not keep their deficit
+                deficits[lane] = 0U;
+                active_lane[lane] = false;
+                active.pop();
+                turn_started = false;
+            }
+        }
+
+    /*********************************/
+
+    private:
+
+        /* Private Attributes */
+
+        /**
+         * @brief Lanes of the Queue.
+         */
+        SQueue<T_QUEUE_ELEMENTS, LANE_SIZE> lanes[NUM_LANES];
+
+        /**
+         * @brief Weight of each lane.
+         */
+        uint32_t weights[NUM_LANES];
+
+        /**
+         * @brief Deficit counter of each lane.
+         */
+        uint64_t deficits[NUM_LANES];
+
+        /**
+         * @brief Lane is in the active list.
+         */
+        bool active_lane[NUM_LANES];
+
+        /**
+         * @brief Number of served elements of each lane.
+         */
+        uint64_t served[NUM_LANES];
+
+        /**
+         * @brief Served cost of each lane.
+         */
+        uint64_t served_costs[NUM_LANES];
+
+        /**
+         * @brief Active list, the non empty lanes in round robin order (each
+         * lane is at most once, so it never overflows).
+         */
+        SQueue<uint32_t, NUM_LANES> active;
+
+        /**
+         * @brief The turn of the front active lane has started (its weight
+         * has been added to its deficit).
+         */
+        bool turn_started;
+
+        /**
+         * @brief Cost function object.
+         */
+        T_COST element_cost;
+
+        /******************************/
+
+        /* Private Methods */
+
+        /**
+         * @brief Select the lane of the next element to be dequeued,
+         * advancing the lane turns while the front active lane has not
+         * enough deficit for its front element.
+         * @return uint32_t The lane number (NUM_LANES if the Queue is
+         * empty).
+         */
+        uint32_t select()
+        {
+            while ( !active.empty() )
+            {
+                uint32_t lane = *(active.front());
+
+                if ( !turn_started )
+                {
+                    deficits[lane] = deficits[lane] + weights[lane];
+                    turn_started = true;
+                }
+
+                if ( element_cost(*(lanes[lane].front())) <= deficits[lane] )
+                    return lane;
+
+                // End of the lane turn, it keeps its deficit
+                active.pop();
+                active.push(lane);
+                turn_started = false;
+            }
+
+            return NUM_LANES;
+        }
+};
+
+/*****************************************************************************/
+
+#endif /* STATIC_DRR_QUEUE_H_ */
@@ -0,0 +1,240 @@
+
+/**
+ * @file    sheapstorage.hpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    17-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * A SQueue storage policy for runtime size Queues whose capacity is only
+ * known at startup (i.e. read from a configuration file), and the SDynQueue
+ * Queue that uses it.
+ *
+ * The storage gets its elements buffer from a single heap allocation done
+ * on construction, with the requested capacity rounded up to a power of
+ * two (so the Queue indexes are wrapped with a mask, as in any static
+ * power of two size Queue), or uses a caller supplied buffer (whose size
+ * must already be a power of two). The buffer is never reallocated, so no
+ * memory allocation is done on the Queue hot path:
+ *
+ *     SDynQueue<t_msg> queue(config.queue_size);
+ *     if ( !queue.storage().valid() ) { ... }
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2022 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#ifndef STATIC_HEAP_STORAGE_H_
+#define STATIC_HEAP_STORAGE_H_
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ libraries
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+// Static Queue
+#include "squeue.hpp"
+
+/*****************************************************************************/
+
+/* Storage Interface */
+
+template <typename T_ELEMENTS, uint64_t STORAGE_SIZE>
+class SQueueHeapStorage
+{
+    static_assert(STORAGE_SIZE == SQUEUE_DYNAMIC_SIZE,
+            "Heap storage is only for runtime size Queues");
+
+    public:
+
+        /* Public Methods */
+
+        /**
+         * @brief Construct a SQueueHeapStorage object, allocating its
+         * buffer.
+         *
+         * @param size Minimum number of elements of the buffer (it is
+         * rounded up to a power of two).
+         */
+        explicit SQueueHeapStorage(size_t size)
+        {
+            size_t count =
+                    SQueueIndex<SQUEUE_DYNAMIC_SIZE>::ceil_capacity(size);
+
+            // In C++11 an array size overflow throws even with nothrow
+            elements = nullptr;
+            if ( (count != 0U) &&
+                 (count <= (static_cast<size_t>(-1) / sizeof(T_ELEMENTS))) )
+                elements = new (std::nothrow) T_ELEMENTS[count];
+            elements_count = ( elements != nullptr ) ? count : 0U;
+            owned = true;
+        }
+
+        /**
+         * @brief Construct a SQueueHeapStorage object that uses the given
+         * buffer (it is not released by the storage).
+         *
+         * @param data Address of the first element of the buffer.
+         *
+         * @param size Number of elements of the buffer. It must be a power
+         * of two, otherwise the storage is not valid.
+         */
+        SQueueHeapStorage(T_ELEMENTS* data, size_t size)
+        {
+            size_t count =
+                    SQueueIndex<SQUEUE_DYNAMIC_SIZE>::floor_capacity(size);
+
+            // A rounded down capacity would silently leave elements unused
+            elements = ( count == size ) ? data : nullptr;
+            elements_count = ( elements != nullptr ) ? count : 0U;
+            owned = false;
+        }
+
+        /**
+         * @brief Construct a SQueueHeapStorage object taking the buffer of
+         * another one.
+         *
+         * @param other Storage to take the buffer from (it is left without
+         * buffer).
+         */
+        SQueueHeapStorage(SQueueHeapStorage&& other)
+        {
+            elements = other.elements;
+            elements_count = other.elements_count;
+            owned = other.owned;
+            other.elements = nullptr;
+            other.elements_count = 0U;
+            other.owned = false;
+        }
+
+        /**
+         * @brief Destroy the SQueueHeapStorage object, releasing its buffer
+         * if it was allocated by the storage.
+         */
+        ~SQueueHeapStorage()
+        {
+            if ( owned )
+                delete[] elements;
+        }
+
+        SQueueHeapStorage(const SQueueHeapStorage&) = delete;
+        SQueueHeapStorage& operator=(const SQueueHeapStorage&) = delete;
+
+        /**
+         * @brief Check if the storage has a buffer with at least one
+         * element.
+         *
+         * @return true if the buffer can be used.
+         *
+         * @return false if the allocation has failed, or the given buffer is
+         * empty or its size is not a power of two (the Queue has capacity
+         * 0, it is always empty and rejects every push).
+         */
+        bool valid() const
+        {
+            return ( elements_count != 0U );
+        }
+
+        /**
+         * @brief Returns reference to the element at the given buffer
+         * position.
+         */
+        T_ELEMENTS& operator[](size_t i) { return elements[i]; }
+        const T_ELEMENTS& operator[](size_t i) const { return elements[i]; }
+
+        /**
+         * @brief Returns the number of elements of the buffer (a power of
+         * two).
+         */
+        size_t capacity() const { return elements_count; }
+
+    /*********************************/
+
+    private:
+
+        /* Private Attributes */
+
+        /**
+         * @brief Buffer first element address.
+         */
+        T_ELEMENTS* elements;
+
+        /**
+         * @brief Number of elements of the buffer.
+         */
+        size_t elements_count;
+
+        /**
+         * @brief The buffer has been allocated by the storage.
+         */
+        bool owned;
+};
+
+/*****************************************************************************/
+
+/* Class Interface */
+
+template <typename T_QUEUE_ELEMENTS>
+class SDynQueue :
+    public SQueue<T_QUEUE_ELEMENTS, SQUEUE_DYNAMIC_SIZE, SQueueHeapStorage>
+{
+    public:
+
+        /* Public Types */
+
+        typedef SQueue<T_QUEUE_ELEMENTS, SQUEUE_DYNAMIC_SIZE,
+                SQueueHeapStorage> t_queue;
+        typedef typename t_queue::storage_type storage_type;
+
+        /* Public Methods */
+
+        /**
+         * @brief Construct a SDynQueue object, allocating its buffer.
+         *
+         * @param capacity Minimum Queue capacity (it is rounded up to a
+         * power of two).
+         */
+        explicit SDynQueue(size_t capacity) :
+            t_queue(storage_type(capacity))
+        {}
+
+        /**
+         * @brief Construct a SDynQueue object that uses the given buffer.
+         *
+         * @param data Address of the first element of the buffer.
+         *
+         * @param size Number of elements of the buffer (a power of two,
+         * otherwise the Queue has capacity 0).
+         */
+        SDynQueue(T_QUEUE_ELEMENTS* data, size_t size) :
+            t_queue(storage_type(data, size))
+        {}
+};
+
+/*****************************************************************************/
+
+#endif /* STATIC_HEAP_STORAGE_H_ */
@@ -0,0 +1,247 @@
+
+/**
+ * @file    shugepagestorage.hpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    17-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * A SQueue storage policy that places the elements buffer in huge pages
+ * (2 MB pages by default), for very large Queues whose buffer spans
+ * thousands of regular 4 KB pages, where the TLB misses dominate the time
+ * to traverse the elements.
+ *
+ * The buffer is mapped once, on the storage construction, with an explicit
+ * huge pages mapping (mmap with MAP_HUGETLB) when the system has huge pages
+ * reserved, falling back to a regular mapping marked for transparent huge
+ * pages (madvise with MADV_HUGEPAGE). One byte of each page is written
+ * before the elements are constructed on the mapping, so every page is
+ * faulted in at that point and no page fault or memory allocation happens
+ * later on the Queue hot path.
+ *
+ * If the mapping can not be done at all, the storage is not valid and has
+ * capacity 0, so the Queue is always empty and rejects every push. valid()
+ * should be checked after construction:
+ *
+ *     SQueue<t_sample, 4194304, SQueueHugePageStorage> queue;
+ *     if ( !queue.storage().valid() ) { ... }
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2022 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#ifndef STATIC_HUGE_PAGE_STORAGE_H_
+#define STATIC_HUGE_PAGE_STORAGE_H_
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ libraries
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+// POSIX libraries
+#include <sys/mman.h>
+#include <unistd.h>
+
+/*****************************************************************************/
+
+/* Build Configuration */
+
+/**
+ * @brief Huge page size used to round up the mapping size (it can be
+ * defined before including this file).
+ */
+#ifndef SQUEUE_HUGE_PAGE_SIZE
+    #define SQUEUE_HUGE_PAGE_SIZE (2U * 1024U * 1024U)
+#endif
+
+/*****************************************************************************/
+
+/* Class Interface */
+
+template <typename T_ELEMENTS, uint64_t STORAGE_SIZE>
+class SQueueHugePageStorage
+{
+    public:
+
+        /* Public Methods */
+
+        /**
+         * @brief Construct a SQueueHugePageStorage object, mapping and
+         * pre-faulting the whole elements buffer.
+         */
+        SQueueHugePageStorage()
+        {
+            void* address = MAP_FAILED;
+
+            elements = nullptr;
+            huge_tlb = false;
+            map_bytes = ((STORAGE_SIZE * sizeof(T_ELEMENTS)) +
+                    SQUEUE_HUGE_PAGE_SIZE - 1U) &
+                    ~(static_cast<size_t>(SQUEUE_HUGE_PAGE_SIZE) - 1U);
+
+        #if defined(MAP_HUGETLB)
+            address = mmap(nullptr, map_bytes, PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+            huge_tlb = ( address != MAP_FAILED );
+        #endif
+
+            if ( address == MAP_FAILED )
+            {
+                address = mmap(nullptr, map_bytes, PROT_READ | PROT_WRITE,
+                        MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+                if ( address == MAP_FAILED )
+                    return;
+
+            #if defined(MADV_HUGEPAGE)
+                // Just a hint, the regular pages are kept if it fails
+                madvise(address, map_bytes, MADV_HUGEPAGE);
+            #endif
+            }
+
+            // Write one byte per page to fault them in, as the elements
+            // constructor may not write anything
+            prefault(static_cast<uint8_t*>(address), map_bytes);
+
+            elements = static_cast<T_ELEMENTS*>(address);
+            for ( size_t i = 0U; i < STORAGE_SIZE; i++ )
+                new (&(elements[i])) T_ELEMENTS();
+        }
+
+        /**
+         * @brief Destroy the SQueueHugePageStorage object, releasing the
+         * mapping.
+         */
+        ~SQueueHugePageStorage()
+        {
+            if ( elements == nullptr )
+                return;
+
+            for ( size_t i = 0U; i < STORAGE_SIZE; i++ )
+                elements[i].~T_ELEMENTS();
+            munmap(static_cast<void*>(elements), map_bytes);
+        }
+
+        SQueueHugePageStorage(const SQueueHugePageStorage&) = delete;
+        SQueueHugePageStorage& operator=(const SQueueHugePageStorage&) =
+                delete;
+
+        /**
+         * @brief Check if the elements buffer has been mapped.
+         *
+         * @return true if the buffer is available.
+         *
+         * @return false if the mapping has failed (the Queue has capacity
+         * 0).
+         */
+        bool valid() const
+        {
+            return ( elements != nullptr );
+        }
+
+        /**
+         * @brief Check if the buffer has been mapped on explicit huge pages
+         * (MAP_HUGETLB), instead of the transparent huge pages fallback.
+         *
+         * @return true if explicit huge pages are used.
+         *
+         * @return false otherwise.
+         */
+        bool huge_pages() const
+        {
+            return huge_tlb;
+        }
+
+        /**
+         * @brief Returns the size of the mapping.
+         *
+         * @return size_t Mapping size in bytes.
+         */
+        size_t bytes() const
+        {
+            return map_bytes;
+        }
+
+        /**
+         * @brief Returns reference to the element at the given buffer
+         * position.
+         */
+        T_ELEMENTS& operator[](size_t i) { return elements[i]; }
+        const T_ELEMENTS& operator[](size_t i) const { return elements[i]; }
+
+        /**
+         * @brief Returns the number of elements of the buffer (0 if the
+         * mapping has failed).
+         */
+        uint64_t capacity() const
+        {
+            return ( elements != nullptr ) ? STORAGE_SIZE : 0U;
+        }
+
+    /*********************************/
+
+    private:
+
+        /* Private Attributes */
+
+        /**
+         * @brief Elements buffer address (nullptr if not mapped).
+         */
+        T_ELEMENTS* elements;
+
+        /**
+         * @brief Mapping size (rounded up to the huge page size).
+         */
+        size_t map_bytes;
+
+        /**
+         * @brief Mapping done with explicit huge pages.
+         */
+        bool huge_tlb;
+
+        /******************************/
+
+        /* Private Methods */
+
+        /**
+         * @brief Fault in all the pages of a mapping, writing one byte per
+         * page.
+         * @param data Mapping address.
+         * @param size Mapping size.
+         */
+        static void prefault(uint8_t* data, size_t size)
+        {
+            volatile uint8_t* bytes = data;
+            size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+
+            for ( size_t offset = 0U; offset < size; offset += page )
+                bytes[offset] = 0U;
+        }
+};
+
+/*****************************************************************************/
+
+#endif /* STATIC_HUGE_PAGE_STORAGE_H_ */
@@ -0,0 +1,356 @@
+
+/**
+ * @file    sintrusivequeue.hpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    17-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Intrusive Queues of elements that already live in long-lived objects
+ * (i.e. static objects or SObjectPool ones), so the elements are linked
+ * into the Queue instead of being copied into a buffer. Each element type
+ * must derive from a hook that holds the link to the next element, so the
+ * Queues do not need any memory of their own, and any push or pop is just
+ * a pointer update (constant time, no copy and no memory allocation).
+ *
+ * An element can only be in one Queue at a time, and it must not be
+ * destroyed while it is linked.
+ *
+ * Components:
+ * - SIntrusiveQueue: single thread Queue of SQueueHook elements.
+ * - SIntrusiveMpscQueue: lock-free Queue of SMpscQueueHook elements, with
+ *   any number of producer threads and a single consumer thread. It is
+ *   the Dmitry Vyukov intrusive MPSC node-based queue, with a stub node
+ *   that is kept in the Queue when it is empty, so a push is just one
+ *   atomic exchange (wait-free) and a pop does not need any atomic read
+ *   modify write operation.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2022 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#ifndef STATIC_INTRUSIVE_QUEUE_H_
+#define STATIC_INTRUSIVE_QUEUE_H_
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ libraries
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+
+/*****************************************************************************/
+
+/* Data Types */
+
+/**
+ * @brief Hook to derive the elements of a SIntrusiveQueue from.
+ */
+struct SQueueHook
+{
+    SQueueHook* next = nullptr;
+};
+
+/**
+ * @brief Hook to derive the elements of a SIntrusiveMpscQueue from.
+ */
+struct SMpscQueueHook
+{
+    std::atomic<SMpscQueueHook*> next{nullptr};
+};
+
+/*****************************************************************************/
+
+/* Class Interface */
+
+template <typename T_QUEUE_ELEMENTS>
+class SIntrusiveQueue
+{
+    static_assert(std::is_base_of<SQueueHook, T_QUEUE_ELEMENTS>::value,
+            "Intrusive Queue elements must derive from SQueueHook");
+
+    public:
+
+        /* Public Methods */
+
+        /**
+         * @brief Construct a SIntrusiveQueue object.
+         */
+        SIntrusiveQueue()
+        {
+            clear();
+        }
+
+        /**
+         * @brief Clear the Queue (the elements are just unlinked).
+         */
+        void clear()
+        {
+            queue_front = nullptr;
+            queue_back = nullptr;
+            queue_size = 0U;
+        }
+
+        /**
+         * @brief Check if the Queue is empty.
+         *
+         * @return true if the Queue is empty.
+         *
+         * @return false otherwise.
+         */
+        bool empty() const
+        {
+            return ( queue_front == nullptr );
+        }
+
+        /**
+         * @brief Returns the number of elements currently linked in the
+         * Queue.
+         *
+         * @return uint32_t The number of elements in the Queue.
+         */
+        uint32_t size() const
+        {
+            return queue_size;
+        }
+
+        /**
+         * @brief Links the given element to the end of the Queue.
+         *
+         * @param element Reference to the element (it must not be linked in
+         * any Queue).
+         */
+        void push(T_QUEUE_ELEMENTS* element)
+        {
+            SQueueHook* hook = element;
+
+            hook->next = nullptr;
+            if ( queue_back == nullptr )
+                queue_front = hook;
+            else
+                queue_back->next = hook;
+            queue_back = hook;
+            queue_size = queue_size + 1U;
+        }
+
+        /**
+         * @brief Returns reference to the first element in the Queue.
+         *
+         * @return T_QUEUE_ELEMENTS* Reference to the first element. If there
+         * is no elements on the Queue, a nullptr is returned.
+         */
+        T_QUEUE_ELEMENTS* front()
+        {
+            return static_cast<T_QUEUE_ELEMENTS*>(queue_front);
+        }
+
+        /**
+         * @brief Returns reference to the last element in the Queue.
+         *
+         * @return T_QUEUE_ELEMENTS* Reference to the last element. If there
+         * is no elements on the Queue, a nullptr is returned.
+         */
+        T_QUEUE_ELEMENTS* back()
+        {
+            return static_cast<T_QUEUE_ELEMENTS*>(queue_back);
+        }
+
+        /**
+         * @brief Unlinks the first element of the Queue. If the Queue is
+         * empty, do nothing.
+         */
+        void pop()
+        {
+            if ( queue_front == nullptr )
+                return;
+
+            queue_front = queue_front->next;
+            if ( queue_front == nullptr )
+                queue_back = nullptr;
+            queue_size = queue_size - 1U;
+        }
+
+    /*********************************/
+
+    private:
+
+        /* Private Attributes */
+
+        /**
+         * @brief First linked element.
+         */
+        SQueueHook* queue_front;
+
+        /**
+         * @brief Last linked element.
+         */
+        SQueueHook* queue_back;
+
+        /**
+         * @brief Number of linked elements.
+         */
+        uint32_t queue_size;
+};
+
+/*****************************************************************************/
+
+template <typename T_QUEUE_ELEMENTS>
+class SIntrusiveMpscQueue
+{
+    static_assert(std::is_base_of<SMpscQueueHook, T_QUEUE_ELEMENTS>::value,
+            "Intrusive MPSC Queue elements must derive from SMpscQueueHook");
+
+    public:
+
+        /* Public Methods */
+
+        /**
+         * @brief Construct a SIntrusiveMpscQueue object.
+         */
+        SIntrusiveMpscQueue()
+        {
+            stub.next.store(nullptr, std::memory_order_relaxed);
+            queue_tail = &stub;
+            queue_head.store(&stub, std::memory_order_release);
+        }
+
+        SIntrusiveMpscQueue(const SIntrusiveMpscQueue&) = delete;
+        SIntrusiveMpscQueue& operator=(const SIntrusiveMpscQueue&) = delete;
+
+        /**
+         * @brief Links the given element to the end of the Queue. Producer
+         * side, it can be called from any thread.
+         *
+         * @param element Reference to the element (it must not be linked in
+         * any Queue).
+         */
+        void push(T_QUEUE_ELEMENTS* element)
+        {
+            link(element);
+        }
+
+        /**
+         * @brief Unlinks the first element of the Queue. Consumer side.
+         *
+         * @return T_QUEUE_ELEMENTS* Reference to the unlinked element. If
+         * the Queue is empty, or the next element push is still in
+         * progress in other thread, a nullptr is returned.
+         */
+        T_QUEUE_ELEMENTS* pop()
+        {
+            SMpscQueueHook* tail = queue_tail;
+            SMpscQueueHook* next = tail->next.load(std::memory_order_acquire);
+
+            // Skip the stub node
+            if ( tail == &stub )
+            {
+                if ( next == nullptr )
+                    return nullptr;
+                queue_tail = next;
+                tail = next;
+                next = next->next.load(std::memory_order_acquire);
+            }
+
+            if ( next != nullptr )
+            {
+                queue_tail = next;
+                return static_cast<T_QUEUE_ELEMENTS*>(tail);
+            }
+
+            // The tail is the last node only if no push is in progress
+            if ( tail != queue_head.load(std::memory_order_acquire) )
+                return nullptr;
+
+            // Push the stub behind the tail to be able to unlink it
+            link(&stub);
+            next = tail->next.load(std::memory_order_acquire);
+            if ( next == nullptr )
+                return nullptr;
+
+            queue_tail = next;
+
+            return static_cast<T_QUEUE_ELEMENTS*>(tail);
+        }
+
+        /**
+         * @brief Check if the Queue is empty. Consumer side.
+         *
+         * @return true if the Queue is empty (it could be in the middle of
+         * a push).
+         *
+         * @return false otherwise.
+         */
+        bool empty() const
+        {
+            return ( (queue_tail == &stub) &&
+                     (stub.next.load(std::memory_order_acquire) == nullptr) );
+        }
+
+    /*********************************/
+
+    private:
+
+        /* Private Attributes */
+
+        /**
+         * @brief Last linked node, where the producers link the new nodes.
+         */
+        alignas(64) std::atomic<SMpscQueueHook*> queue_head;
+
+        /**
+         * @brief First linked node, only used by the consumer.
+         */
+        alignas(64) SMpscQueueHook* queue_tail;
+
+        /**
+         * @brief Stub node, linked when the Queue gets empty.
+         */
+        SMpscQueueHook stub;
+
+        /******************************/
+
+        /* Private Methods */
+
+        /**
+         * @brief Link a node to the end of the Queue.
+         * @param node Node to link.
+         * @details
+         * Between the exchange and the store the previous node is not linked
+         * to the new one yet, so the consumer sees the Queue as empty until
+         * the store is done.
+         */
+        void link(SMpscQueueHook* node)
+        {
+            SMpscQueueHook* prev;
+
+            node->next.store(nullptr, std::memory_order_relaxed);
+            prev = queue_head.exchange(node, std::memory_order_acq_rel);
+            prev->next.store(node, std::memory_order_release);
+        }
+};
+
+/*****************************************************************************/
+
+#endif /* STATIC_INTRUSIVE_QUEUE_H_ */
@@ -0,0 +1,563 @@
+
+/**
+ * @file    sjournalqueue.hpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    17-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * A persistent Queue whose elements buffer and indexes live in a memory
+ * mapped file, so the committed elements survive a process crash (and,
+ * depending on the durability level, a system crash) and are recovered
+ * when the Queue file is opened again.
+ *
+ * The push() and pop() operations work on the mapped buffer as a regular
+ * SQueue, but they are not persistent until commit() is called. The file
+ * header keeps two 64 bits records (front index and number of elements):
+ * the live record, written by every commit, and the synced record, only
+ * written after the elements it refers to have been flushed to disk, and
+ * flushed itself right after them. The kernel can write the header page
+ * back at any time, before the element pages, so only the synced record
+ * is safe after a system crash.
+ *
+ * When a push needs to overwrite the oldest element of a record (the Queue
+ * is full, or that element has been popped but not committed yet), the
+ * removal of that element is written to the record first (and flushed for
+ * the synced one), so an uncommitted push never corrupts a recorded
+ * element (the recovered Queue just misses the recorded elements that have
+ * been overwritten).
+ *
+ * The durability level sets when the mapped memory is flushed to disk, and
+ * the record the Queue is recovered from when the file is opened:
+ * - JOURNAL_SYNC_NONE: never flushed, the kernel writes the pages back at
+ *   its own pace. Recovered from the live record: the elements of the last
+ *   commit after a process crash, no guarantee after a system crash.
+ * - JOURNAL_SYNC_PERIODIC: flushed once every a configurable number of
+ *   commits (and on sync()). Recovered from the synced record: the
+ *   elements of the last flushed commit after a process or a system crash
+ *   (the commits done since that flush are lost).
+ * - JOURNAL_SYNC_BATCH: flushed on every commit. Recovered from the synced
+ *   record: the elements of the last commit after a process or a system
+ *   crash.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2022 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#ifndef STATIC_JOURNAL_QUEUE_H_
+#define STATIC_JOURNAL_QUEUE_H_
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ libraries
+#include <atomic>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+
+// Static Queue
+#include "squeue.hpp"
+
+// Shared memory mapping
+#include "smemmap.hpp"
+
+/*****************************************************************************/
+
+/* Data Types */
+
+typedef enum t_journal_sync
+{
+    JOURNAL_SYNC_NONE     = 0,
+    JOURNAL_SYNC_PERIODIC = 1,
+    JOURNAL_SYNC_BATCH    = 2,
+} t_journal_sync;
+
+/*****************************************************************************/
+
+/* Class Interface */
+
+template <typename T_QUEUE_ELEMENTS, uint32_t QUEUE_SIZE>
+class SJournalQueue
+{
+    static_assert(std::is_trivially_copyable<T_QUEUE_ELEMENTS>::value,
+            "Journal Queue elements must be trivially copyable");
+    static_assert(ATOMIC_LLONG_LOCK_FREE == 2,
+            "Journal Queue requires lock-free 64 bits atomics");
+
+    public:
+
+        /* Public Constants */
+
+        static const uint32_t MAGIC = 0x53514A51U; // "SQJQ"
+        static const uint32_t VERSION = 2U;
+
+        /* Public Methods */
+
+        /**
+         * @brief Construct a SJournalQueue object (not opened).
+         */
+        SJournalQueue() : header(nullptr), slots(nullptr)
+        {
+            durability = JOURNAL_SYNC_NONE;
+            sync_interval = 1U;
+            commits_since_sync = 0U;
+            queue_tail = 0U;
+            num_elements_stored = 0U;
+            unsynced_first = 0U;
+            unsynced_count = 0U;
+        }
+
+        /**
+         * @brief Open (or create) the Queue file and recover its committed
+         * elements.
+         *
+         * @param path Queue file path.
+         *
+         * @param sync Durability level.
+         *
+         * @param interval Number of commits between flushes for the
+         * JOURNAL_SYNC_PERIODIC durability level.
+         *
+         * @return true if the Queue has been opened.
+         *
+         * @return false otherwise (any system call failed or the file is
+         * not a Queue file of this element type and size).
+         */
+        bool open(const char* path, t_journal_sync sync = JOURNAL_SYNC_NONE,
+                uint32_t interval = 64U)
+        {
+            uint64_t record;
+
+            if ( !memory.open(path, map_size(), SMEM_FILE, true) )
+                return false;
+
+            header = reinterpret_cast<t_header*>(memory.data());
+            slots = reinterpret_cast<T_QUEUE_ELEMENTS*>(
+                    memory.data() + slots_offset());
+
+            // A new file is zero filled, initialize it
+            if ( header->magic == 0U )
+            {
+                header->version = VERSION;
+                header->element_size = sizeof(T_QUEUE_ELEMENTS);
+                header->capacity = QUEUE_SIZE;
+                new (&(header->commit)) std::atomic<uint64_t>(0U);
+                new (&(header->synced)) std::atomic<uint64_t>(0U);
+                header->magic = MAGIC;
+                memory.sync(0U, sizeof(t_header));
+            }
+
+            if ( (header->magic != MAGIC) || (header->version != VERSION) ||
+                 (header->element_size != sizeof(T_QUEUE_ELEMENTS)) ||
+                 (header->capacity != QUEUE_SIZE) )
+            {
+                close();
+                return false;
+            }
+
+            // The live record can refer to elements never flushed to disk
+            if ( sync == JOURNAL_SYNC_NONE )
+                record = header->commit.load(std::memory_order_acquire);
+            else
+                record = header->synced.load(std::memory_order_acquire);
+            queue_tail = record_tail(record);
+            num_elements_stored = record_count(record);
+            if ( (queue_tail >= QUEUE_SIZE) ||
+                 (num_elements_stored > QUEUE_SIZE) )
+            {
+                close();
+                return false;
+            }
+            write_record(queue_tail, num_elements_stored);
+
+            durability = sync;
+            sync_interval = ( interval == 0U ) ? 1U : interval;
+            commits_since_sync = 0U;
+
+            // Elements recovered from the live record may not be on disk
+            unsynced_first = queue_tail;
+            unsynced_count = num_elements_stored;
+
+            return true;
+        }
+
+        /**
+         * @brief Close the Queue file. Any uncommitted change is lost.
+         */
+        void close()
+        {
+            memory.close();
+            header = nullptr;
+            slots = nullptr;
+        }
+
+        /**
+         * @brief Check if the Queue file is opened.
+         *
+         * @return true if the Queue is opened.
+         *
+         * @return false otherwise.
+         */
+        bool is_open() const
+        {
+            return ( header != nullptr );
+        }
+
+        /**
+         * @brief Check if the Queue is empty (including uncommitted changes).
+         *
+         * @return true if the Queue is empty.
+         *
+         * @return false otherwise.
+         */
+        bool empty() const
+        {
+            return ( num_elements_stored == 0U );
+        }
+
+        /**
+         * @brief Returns the number of elements currently stored in the
+         * Queue (including uncommitted changes).
+         *
+         * @return uint32_t The number of elements in the Queue.
+         */
+        uint32_t size() const
+        {
+            return num_elements_stored;
+        }
+
+        /**
+         * @brief Returns reference to the first element in the Queue.
+         *
+         * @return T_QUEUE_ELEMENTS* Reference to the first element. If there
+         * is no elements on the Queue, a nullptr is returned.
+         */
+        T_QUEUE_ELEMENTS* front()
+        {
+            if ( empty() )
+                return nullptr;
+
+            return &(slots[queue_tail]);
+        }
+
+        /**
+         * @brief Pushes the given element value to the end of the Queue (not
+         * persistent until commit() is called).
+         *
+         * @param element The value of the element to push.
+         *
+         * @return t_overflow BUFFER_OVERFLOW if the oldest element has been
+         * overwritten, BUFFER_OK otherwise.
+         *
+         * @details
+         * If the slot of the new element holds the oldest element of a
+         * record, its removal is written to that record (and flushed for the
+         * synced record, unless the durability level is JOURNAL_SYNC_NONE)
+         * before writing it.
+         */
+        t_overflow push(const T_QUEUE_ELEMENTS& element)
+        {
+            t_overflow result = BUFFER_OK;
+            uint32_t slot = index(queue_tail, num_elements_stored);
+            uint64_t record = header->commit.load(std::memory_order_relaxed);
+            uint64_t synced = header->synced.load(std::memory_order_relaxed);
+
+            if ( num_elements_stored >= QUEUE_SIZE )
+            {
+                queue_tail = index(queue_tail, 1U);
+                num_elements_stored = num_elements_stored - 1U;
+                result = BUFFER_OVERFLOW;
+            }
+
+            // The write position reaches the recorded elements at its front
+            if ( (record_count(record) > 0U) && (slot == record_tail(record)) )
+                write_record(index(slot, 1U), record_count(record) - 1U);
+            if ( (record_count(synced) > 0U) && (slot == record_tail(synced)) )
+            {
+                write_synced(index(slot, 1U), record_count(synced) - 1U);
+                if ( durability != JOURNAL_SYNC_NONE )
+                    memory.sync(0U, sizeof(t_header));
+            }
+
+            slots[slot] = element;
+            num_elements_stored = num_elements_stored + 1U;
+            mark_unsynced(slot);
+
+            return result;
+        }
+
+        /**
+         * @brief Removes an element from the front of the Queue (not
+         * persistent until commit() is called). If the Queue is empty, do
+         * nothing.
+         */
+        void pop()
+        {
+            if ( empty() )
+                return;
+
+            queue_tail = index(queue_tail, 1U);
+            num_elements_stored = num_elements_stored - 1U;
+        }
+
+        /**
+         * @brief Commit the current Queue state, making the pushes and pops
+         * done since the last commit persistent.
+         *
+         * @details
+         * The elements are always written before the live record, and the
+         * memory is flushed to disk according to the durability level.
+         */
+        void commit()
+        {
+            commits_since_sync = commits_since_sync + 1U;
+
+            if ( (durability == JOURNAL_SYNC_BATCH) ||
+                 ((durability == JOURNAL_SYNC_PERIODIC) &&
+                  (commits_since_sync >= sync_interval)) )
+                sync();
+            else
+                write_record(queue_tail, num_elements_stored);
+        }
+
+        /**
+         * @brief Commit the current Queue state and flush it to disk,
+         * whatever the durability level is.
+         *
+         * @details
+         * The written elements are flushed before the synced record is
+         * written, and then the header is flushed.
+         */
+        void sync()
+        {
+            sync_elements();
+            write_record(queue_tail, num_elements_stored);
+            write_synced(queue_tail, num_elements_stored);
+            memory.sync(0U, sizeof(t_header));
+            commits_since_sync = 0U;
+        }
+
+    /*********************************/
+
+    private:
+
+        /* Private Data Types */
+
+        /**
+         * @brief Queue file header.
+         */
+        struct t_header
+        {
+            uint32_t magic;
+            uint32_t version;
+            uint32_t element_size;
+            uint32_t capacity;
+            std::atomic<uint64_t> commit;
+            std::atomic<uint64_t> synced;
+        };
+
+        /* Private Attributes */
+
+        /**
+         * @brief Queue file mapping.
+         */
+        SMemMap memory;
+
+        /**
+         * @brief Queue file header address.
+         */
+        t_header* header;
+
+        /**
+         * @brief Queue file elements buffer address.
+         */
+        T_QUEUE_ELEMENTS* slots;
+
+        /**
+         * @brief Durability level.
+         */
+        t_journal_sync durability;
+
+        /**
+         * @brief Number of commits between flushes (periodic durability).
+         */
+        uint32_t sync_interval;
+
+        /**
+         * @brief Number of commits since the last flush.
+         */
+        uint32_t commits_since_sync;
+
+        /**
+         * @brief Buffer index of the front element.
+         */
+        uint32_t queue_tail;
+
+        /**
+         * @brief Current number of elements stored in the buffer.
+         */
+        uint32_t num_elements_stored;
+
+        /**
+         * @brief First buffer index written since the last flush.
+         */
+        uint32_t unsynced_first;
+
+        /**
+         * @brief Number of consecutive buffer slots written since the last
+         * flush.
+         */
+        uint32_t unsynced_count;
+
+        /******************************/
+
+        /* Private Methods */
+
+        /**
+         * @brief Get the offset of the elements buffer in the file, the
+         * header size rounded up to a cache line.
+         * @return size_t Elements buffer offset.
+         */
+        static size_t slots_offset()
+        {
+            return (sizeof(t_header) + 63U) & ~static_cast<size_t>(63U);
+        }
+
+        /**
+         * @brief Get the total file size.
+         * @return size_t File size.
+         */
+        static size_t map_size()
+        {
+            return slots_offset() + (sizeof(T_QUEUE_ELEMENTS) * QUEUE_SIZE);
+        }
+
+        /**
+         * @brief Get the buffer index that is a number of slots after
+         * another one.
+         * @param i Buffer index.
+         * @param n Number of slots, up to QUEUE_SIZE.
+         * @return uint32_t The buffer index.
+         */
+        static uint32_t index(uint32_t i, uint32_t n)
+        {
+            uint32_t result = i + n;
+
+            if ( result >= QUEUE_SIZE )
+                result = result - QUEUE_SIZE;
+
+            return result;
+        }
+
+        /**
+         * @brief Get the front element index from a record.
+         * @param record Live or synced record.
+         * @return uint32_t Front element buffer index.
+         */
+        static uint32_t record_tail(uint64_t record)
+        {
+            return static_cast<uint32_t>(record);
+        }
+
+        /**
+         * @brief Get the number of elements from a record.
+         * @param record Live or synced record.
+         * @return uint32_t Number of elements.
+         */
+        static uint32_t record_count(uint64_t record)
+        {
+            return static_cast<uint32_t>(record >> 32);
+        }
+
+        /**
+         * @brief Write the live record with release ordering, so it is
+         * never observed before the elements written previously.
+         * @param tail Committed front element index.
+         * @param count Committed number of elements.
+         */
+        void write_record(uint32_t tail, uint32_t count)
+        {
+            uint64_t record = (static_cast<uint64_t>(count) << 32) | tail;
+            header->commit.store(record, std::memory_order_release);
+        }
+
+        /**
+         * @brief Write the synced record (its elements must have been
+         * flushed to disk before).
+         * @param tail Synced front element index.
+         * @param count Synced number of elements.
+         */
+        void write_synced(uint32_t tail, uint32_t count)
+        {
+            uint64_t record = (static_cast<uint64_t>(count) << 32) | tail;
+            header->synced.store(record, std::memory_order_release);
+        }
+
+        /**
+         * @brief Track a written buffer slot for the next flush.
+         * @param slot Written buffer index.
+         */
+        void mark_unsynced(uint32_t slot)
+        {
+            if ( unsynced_count == 0U )
+                unsynced_first = slot;
+            if ( unsynced_count < QUEUE_SIZE )
+                unsynced_count = unsynced_count + 1U;
+            else
+                unsynced_first = index(slot, 1U);
+        }
+
+        /**
+         * @brief Flush the buffer slots written since the last flush (at
+         * most two ranges, as they can wrap around the buffer end).
+         */
+        void sync_elements()
+        {
+            uint32_t first_count;
+
+            if ( unsynced_count == 0U )
+                return;
+
+            first_count = QUEUE_SIZE - unsynced_first;
+            if ( first_count > unsynced_count )
+                first_count = unsynced_count;
+
+            memory.sync(slots_offset() +
+                    (unsynced_first * sizeof(T_QUEUE_ELEMENTS)),
+                    first_count * sizeof(T_QUEUE_ELEMENTS));
+            if ( first_count < unsynced_count )
+            {
+                memory.sync(slots_offset(),
+                        (unsynced_count - first_count) *
+                        sizeof(T_QUEUE_ELEMENTS));
+            }
+
+            unsynced_count = 0U;
+        }
+};
+
+/*****************************************************************************/
+
+#endif /* STATIC_JOURNAL_QUEUE_H_ */
@@ -0,0 +1,282 @@
+
+/**
+ * @file    smemmap.hpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    17-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * A minimal wrapper of a shared memory mapping (POSIX shared memory object
+ * or regular file mapped with mmap), used to place the state of the Queue
+ * components outside the process memory, so it can be shared between
+ * processes or persisted.
+ *
+ * The mapping is done once when opening it, so no memory allocation or
+ * system call is done on the Queue hot path.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2022 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#ifndef STATIC_MEM_MAP_H_
+#define STATIC_MEM_MAP_H_
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ libraries
+#include <cstddef>
+#include <cstdint>
+
+// POSIX libraries
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/*****************************************************************************/
+
+/* Data Types */
+
+typedef enum t_smem_backing
+{
+    SMEM_SHM  = 0,
+    SMEM_FILE = 1,
+} t_smem_backing;
+
+/*****************************************************************************/
+
+/* Class Interface */
+
+class SMemMap
+{
+    public:
+
+        /* Public Methods */
+
+        /**
+         * @brief Construct a SMemMap object (not mapped).
+         */
+        SMemMap() : map_data(nullptr), map_size(0U), map_fd(-1) {}
+
+        /**
+         * @brief Destroy the SMemMap object, releasing the mapping.
+         */
+        ~SMemMap()
+        {
+            close();
+        }
+
+        SMemMap(const SMemMap&) = delete;
+        SMemMap& operator=(const SMemMap&) = delete;
+
+        /**
+         * @brief Map a shared memory object or a file.
+         *
+         * @param name Shared memory object name (i.e. "/my_queue") or file
+         * path, depending on the backing type.
+         *
+         * @param size Number of bytes to map.
+         *
+         * @param backing Backing type (SMEM_SHM or SMEM_FILE).
+         *
+         * @param create Create the object if it does not exists, and extend
+         * it to the requested size if it is smaller (new bytes are zero).
+         *
+         * @return true if the object has been mapped.
+         *
+         * @return false otherwise (the object does not exists and create is
+         * false, it is smaller than the requested size, or any system call
+         * has failed).
+         */
+        bool open(const char* name, size_t size, t_smem_backing backing,
+                bool create)
+        {
+            struct stat info;
+            int flags = O_RDWR;
+            void* data;
+
+            close();
+
+            if ( create )
+                flags = flags | O_CREAT;
+
+            if ( backing == SMEM_SHM )
+                map_fd = shm_open(name, flags, 0600);
+            else
+                map_fd = ::open(name, flags, 0600);
+            if ( map_fd < 0 )
+                return false;
+
+            if ( fstat(map_fd, &info) != 0 )
+            {
+                close();
+                return false;
+            }
+
+            if ( static_cast<size_t>(info.st_size) < size )
+            {
+                if ( !create || (ftruncate(map_fd, size) != 0) )
+                {
+                    close();
+                    return false;
+                }
+            }
+
+            data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED,
+                    map_fd, 0);
+            if ( data == MAP_FAILED )
+            {
+                close();
+                return false;
+            }
+
+            map_data = static_cast<uint8_t*>(data);
+            map_size = size;
+
+            return true;
+        }
+
+        /**
+         * @brief Release the mapping (the object itself is kept).
+         */
+        void close()
+        {
+            if ( map_data != nullptr )
+                munmap(map_data, map_size);
+            if ( map_fd >= 0 )
+                ::close(map_fd);
+
+            map_data = nullptr;
+            map_size = 0U;
+            map_fd = -1;
+        }
+
+        /**
+         * @brief Flush a range of the mapping to its backing storage.
+         *
+         * @param offset Offset of the first byte to flush.
+         *
+         * @param size Number of bytes to flush.
+         *
+         * @return true if the range has been flushed.
+         *
+         * @return false otherwise.
+         *
+         * @details
+         * The range is extended to the page boundaries as required by msync.
+         */
+        bool sync(size_t offset, size_t size)
+        {
+            size_t page, start;
+
+            if ( map_data == nullptr )
+                return false;
+
+            page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+            start = offset - (offset % page);
+
+            return ( msync(map_data + start, (offset - start) + size,
+                    MS_SYNC) == 0 );
+        }
+
+        /**
+         * @brief Check if the object is mapped.
+         *
+         * @return true if the object is mapped.
+         *
+         * @return false otherwise.
+         */
+        bool is_open() const
+        {
+            return ( map_data != nullptr );
+        }
+
+        /**
+         * @brief Returns the address of the mapping.
+         *
+         * @return uint8_t* The mapping address (nullptr if not mapped).
+         */
+        uint8_t* data() const
+        {
+            return map_data;
+        }
+
+        /**
+         * @brief Returns the number of bytes of the mapping.
+         *
+         * @return size_t The mapping size.
+         */
+        size_t size() const
+        {
+            return map_size;
+        }
+
+        /**
+         * @brief Remove a shared memory object or a file.
+         *
+         * @param name Shared memory object name or file path.
+         *
+         * @param backing Backing type (SMEM_SHM or SMEM_FILE).
+         *
+         * @return true if the object has been removed.
+         *
+         * @return false otherwise.
+         *
+         * @details
+         * The current mappings of the object are still valid until closed.
+         */
+        static bool remove(const char* name, t_smem_backing backing)
+        {
+            if ( backing == SMEM_SHM )
+                return ( shm_unlink(name) == 0 );
+
+            return ( unlink(name) == 0 );
+        }
+
+    /*********************************/
+
+    private:
+
+        /* Private Attributes */
+
+        /**
+         * @brief Mapping address.
+         */
+        uint8_t* map_data;
+
+        /**
+         * @brief Mapping size in bytes.
+         */
+        size_t map_size;
+
+        /**
+         * @brief Mapped object file descriptor.
+         */
+        int map_fd;
+};
+
+/*****************************************************************************/
+
+#endif /* STATIC_MEM_MAP_H_ */
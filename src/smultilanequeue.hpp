@@ -0,0 +1,360 @@
+
+/**
+ * @file    smultilanequeue.hpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    17-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * A static memory allocated priority Queue for a few priority classes (up
+ * to 32), composed of one SQueue (lane) per priority level, where the
+ * first element is always the oldest one of the highest priority non
+ * empty lane. Lane 0 has the highest priority.
+ *
+ * The capacity of each lane is given by the lane sizes template parameters
+ * (powers of two). All the lanes share a single static elements array,
+ * each lane being a SQueue with span storage over its own slice of it.
+ *
+ * A bitmask of the non empty lanes (lane i at bit 31-i) is kept updated on
+ * each push and pop, so the highest priority non empty lane is found with
+ * a single count leading zeros instruction, without checking each lane.
+ *
+ * As in SQueue, a push in a full lane overwrites the oldest element of that
+ * lane, and it is counted in the lane overflow counter.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2022 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#ifndef STATIC_MULTI_LANE_QUEUE_H_
+#define STATIC_MULTI_LANE_QUEUE_H_
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ libraries
+#include <cstdint>
+
+// Static Queue
+#include "squeue.hpp"
+
+// Span storage for the lanes
+#include "sspanstorage.hpp"
+
+/*****************************************************************************/
+
+/* Class Interface */
+
+template <typename T_QUEUE_ELEMENTS, uint32_t... LANE_SIZES>
+class SMultiLaneQueue
+{
+    public:
+
+        /* Public Constants */
+
+        /**
+         * @brief Number of lanes.
+         */
+        static const uint32_t NUM_LANES = sizeof...(LANE_SIZES);
+
+    private:
+
+        static_assert((NUM_LANES > 0U) && (NUM_LANES <= 32U),
+                "Multi-lane Queue must have between 1 and 32 lanes");
+
+        /**
+         * @brief Check that all the lane sizes are powers of two.
+         * @return true if all the sizes are powers of two.
+         */
+        static constexpr bool all_pow2()
+        {
+            return true;
+        }
+
+        template <typename... T_SIZES>
+        static constexpr bool all_pow2(uint32_t size, T_SIZES... sizes)
+        {
+            return (size > 0U) && ((size & (size - 1U)) == 0U) &&
+                    all_pow2(sizes...);
+        }
+
+        /**
+         * @brief Get the sum of the lane sizes.
+         * @return uint64_t The sum of the sizes.
+         */
+        static constexpr uint64_t sum()
+        {
+            return 0U;
+        }
+
+        template <typename... T_SIZES>
+        static constexpr uint64_t sum(uint32_t size, T_SIZES... sizes)
+        {
+            return size + sum(sizes...);
+        }
+
+        static_assert(all_pow2(LANE_SIZES...),
+                "Multi-lane Queue lane sizes must be powers of two");
+
+    public:
+
+        /* Public Types */
+
+        typedef SQueue<T_QUEUE_ELEMENTS, SQUEUE_DYNAMIC_SIZE,
+                SQueueSpanStorage> t_lane;
+
+        /* Public Methods */
+
+        /**
+         * @brief Construct a SMultiLaneQueue object, assigning to each lane
+         * its slice of the elements array.
+         */
+        SMultiLaneQueue()
+        {
+            static const uint32_t sizes[NUM_LANES] = { LANE_SIZES... };
+            uint64_t offset = 0U;
+
+            for ( uint32_t i = 0U; i < NUM_LANES; i++ )
+            {
+                lanes[i] = t_lane(typename t_lane::storage_type(
+                        &(elements[offset]), sizes[i]));
+                offset = offset + sizes[i];
+                overflows[i] = 0U;
+            }
+            non_empty = 0U;
+        }
+
+        SMultiLaneQueue(const SMultiLaneQueue&) = delete;
+        SMultiLaneQueue& operator=(const SMultiLaneQueue&) = delete;
+
+        /**
+         * @brief Clear all the lanes and overflow counters.
+         */
+        void clear()
+        {
+            for ( uint32_t i = 0U; i < NUM_LANES; i++ )
+            {
+                lanes[i].clear();
+                overflows[i] = 0U;
+            }
+            non_empty = 0U;
+        }
+
+        /**
+         * @brief Check if all the lanes are empty.
+         *
+         * @return true if the Queue is empty.
+         *
+         * @return false otherwise.
+         */
+        bool empty() const
+        {
+            return ( non_empty == 0U );
+        }
+
+        /**
+         * @brief Returns the number of elements currently stored in all the
+         * lanes.
+         *
+         * @return uint64_t The number of elements in the Queue.
+         */
+        uint64_t size() const
+        {
+            uint64_t result = 0U;
+
+            for ( uint32_t i = 0U; i < NUM_LANES; i++ )
+                result = result + lanes[i].size();
+
+            return result;
+        }
+
+        /**
+         * @brief Returns reference to a lane (i.e. to check its size).
+         *
+         * @param lane Lane number (0 is the highest priority one).
+         *
+         * @return const t_lane* Reference to the lane. If the lane number is
+         * out of range, a nullptr is returned.
+         */
+        const t_lane* lane(uint32_t lane) const
+        {
+            if ( lane >= NUM_LANES )
+                return nullptr;
+
+            return &(lanes[lane]);
+        }
+
+        /**
+         * @brief Returns the number of elements overwritten in a lane
+         * because it was full.
+         *
+         * @param lane Lane number.
+         *
+         * @return uint32_t The lane overflow counter (0 if the lane number
+         * is out of range).
+         */
+        uint32_t overflow_count(uint32_t lane) const
+        {
+            if ( lane >= NUM_LANES )
+                return 0U;
+
+            return overflows[lane];
+        }
+
+        /**
+         * @brief Pushes the given element value to the end of a lane.
+         *
+         * @param lane Lane number (0 is the highest priority one).
+         *
+         * @param element The value of the element to push.
+         *
+         * @return t_overflow BUFFER_OVERFLOW if the oldest element of the
+         * lane has been overwritten or the lane number is out of range (the
+         * element is discarded), BUFFER_OK otherwise.
+         */
+        t_overflow push(uint32_t lane, const T_QUEUE_ELEMENTS& element)
+        {
+            if ( lane >= NUM_LANES )
+                return BUFFER_OVERFLOW;
+
+            non_empty = non_empty | lane_bit(lane);
+            if ( lanes[lane].push(element) == BUFFER_OK )
+                return BUFFER_OK;
+
+            overflows[lane] = overflows[lane] + 1U;
+
+            return BUFFER_OVERFLOW;
+        }
+
+        /**
+         * @brief Returns the number of the highest priority non empty lane.
+         *
+         * @return uint32_t The lane number (NUM_LANES if the Queue is
+         * empty).
+         */
+        uint32_t top_lane() const
+        {
+            if ( non_empty == 0U )
+                return NUM_LANES;
+
+            return clz(non_empty);
+        }
+
+        /**
+         * @brief Returns reference to the first element of the highest
+         * priority non empty lane.
+         *
+         * @return T_QUEUE_ELEMENTS* Reference to the element. If there is no
+         * elements on the Queue, a nullptr is returned.
+         */
+        T_QUEUE_ELEMENTS* front()
+        {
+            if ( non_empty == 0U )
+                return nullptr;
+
+            return lanes[clz(non_empty)].front();
+        }
+
+        /**
+         * @brief Removes the first element of the highest priority non empty
+         * lane. If the Queue is empty, do nothing.
+         */
+        void pop()
+        {
+            uint32_t lane;
+
+            if ( non_empty == 0U )
+                return;
+
+            lane = clz(non_empty);
+            lanes[lane].pop();
+            if ( lanes[lane].empty() )
+                non_empty = non_empty & ~lane_bit(lane);
+        }
+
+    /*********************************/
+
+    private:
+
+        /* Private Attributes */
+
+        /**
+         * @brief Elements of all the lanes.
+         */
+        T_QUEUE_ELEMENTS elements[sum(LANE_SIZES...)];
+
+        /**
+         * @brief Lanes, each one over its slice of the elements array.
+         */
+        t_lane lanes[NUM_LANES];
+
+        /**
+         * @brief Overflow counter of each lane.
+         */
+        uint32_t overflows[NUM_LANES];
+
+        /**
+         * @brief Mask of the non empty lanes (lane i at bit 31-i).
+         */
+        uint32_t non_empty;
+
+        /******************************/
+
+        /* Private Methods */
+
+        /**
+         * @brief Get the bit of a lane in the non empty lanes mask.
+         * @param lane Lane number.
+         * @return uint32_t The lane bit.
+         */
+        static uint32_t lane_bit(uint32_t lane)
+        {
+            return 0x80000000U >> lane;
+        }
+
+        /**
+         * @brief Count the leading zero bits of a non zero word (the number
+         * of the highest priority lane of a mask).
+         * @param x The word.
+         * @return uint32_t The number of leading zeros.
+         */
+        static uint32_t clz(uint32_t x)
+        {
+        #if defined(__GNUC__)
+            return static_cast<uint32_t>(__builtin_clz(x));
+        #else
+            uint32_t n = 0U;
+            while ( (x & 0x80000000U) == 0U )
+            {
+                x = x << 1;
+                n = n + 1U;
+            }
+            return n;
+        #endif
+        }
+};
+
+/*****************************************************************************/
+
+#endif /* STATIC_MULTI_LANE_QUEUE_H_ */
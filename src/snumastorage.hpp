@@ -0,0 +1,271 @@
+
+/**
+ * @file    snumastorage.hpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    17-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * A SQueue storage policy that controls the NUMA node where the elements
+ * buffer pages are placed, for Queues shared between threads running on
+ * different sockets, where a buffer on the remote node of the consumer
+ * increases its latency.
+ *
+ * The buffer is mapped and its pages written on the storage construction,
+ * so with the default kernel policy the pages are placed on the node of the
+ * constructing thread (first-touch). They can be moved later to any other
+ * node with bind(), i.e. from the consumer thread:
+ *
+ *     SQueue<t_order, 65536, SQueueNumaStorage> queue;
+ *     queue.storage().bind(SQueueNumaStorage<t_order, 65536>::
+ *             current_node());
+ *
+ * The binding is done with the mbind system call, without any dependency
+ * on libnuma. On single node machines, kernels without NUMA support or
+ * non Linux systems, bind() just fails and the buffer is kept where it is,
+ * so the Queue can always be used.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2022 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#ifndef STATIC_NUMA_STORAGE_H_
+#define STATIC_NUMA_STORAGE_H_
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ libraries
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+// POSIX libraries
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+/*****************************************************************************/
+
+/* Class Interface */
+
+template <typename T_ELEMENTS, uint64_t STORAGE_SIZE>
+class SQueueNumaStorage
+{
+    public:
+
+        /* Public Methods */
+
+        /**
+         * @brief Construct a SQueueNumaStorage object, mapping the elements
+         * buffer on the NUMA node of the calling thread (first-touch).
+         */
+        SQueueNumaStorage()
+        {
+            void* address;
+            size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+
+            elements = nullptr;
+            map_bytes = ((STORAGE_SIZE * sizeof(T_ELEMENTS)) + page - 1U) &
+                    ~(page - 1U);
+            buffer_node = current_node();
+
+            address = mmap(nullptr, map_bytes, PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if ( address == MAP_FAILED )
+                return;
+
+            // Write one byte per page to fault them in on this node, as the
+            // elements constructor may not write anything
+            volatile uint8_t* bytes = static_cast<uint8_t*>(address);
+            for ( size_t offset = 0U; offset < map_bytes; offset += page )
+                bytes[offset] = 0U;
+
+            elements = static_cast<T_ELEMENTS*>(address);
+            for ( size_t i = 0U; i < STORAGE_SIZE; i++ )
+                new (&(elements[i])) T_ELEMENTS();
+        }
+
+        /**
+         * @brief Destroy the SQueueNumaStorage object, releasing the
+         * mapping.
+         */
+        ~SQueueNumaStorage()
+        {
+            if ( elements == nullptr )
+                return;
+
+            for ( size_t i = 0U; i < STORAGE_SIZE; i++ )
+                elements[i].~T_ELEMENTS();
+            munmap(static_cast<void*>(elements), map_bytes);
+        }
+
+        SQueueNumaStorage(const SQueueNumaStorage&) = delete;
+        SQueueNumaStorage& operator=(const SQueueNumaStorage&) = delete;
+
+        /**
+         * @brief Check if the elements buffer has been mapped.
+         *
+         * @return true if the buffer is available.
+         *
+         * @return false if the mapping has failed (the Queue has capacity
+         * 0).
+         */
+        bool valid() const
+        {
+            return ( elements != nullptr );
+        }
+
+        /**
+         * @brief Binds the elements buffer to a NUMA node, moving the pages
+         * that are currently placed on any other node.
+         *
+         * @param node NUMA node number.
+         *
+         * @return true if the buffer has been bound to the node.
+         *
+         * @return false if the node does not exist or NUMA is not supported
+         * (the buffer is kept where it was).
+         *
+         * @details
+         * The pages are moved by the kernel while the call is done, so it
+         * must be called before the Queue is in use, not from the hot path.
+         */
+        bool bind(int node)
+        {
+        #if defined(__linux__) && defined(SYS_mbind)
+            unsigned long mask[MASK_WORDS] = { 0U };
+            const size_t word_bits = 8U * sizeof(unsigned long);
+
+            if ( (elements == nullptr) || (node < 0) ||
+                 (static_cast<size_t>(node) >= (MASK_WORDS * word_bits)) )
+                return false;
+
+            mask[node / word_bits] = 1UL << (node % word_bits);
+            if ( syscall(SYS_mbind, static_cast<void*>(elements), map_bytes,
+                    MPOL_BIND_MODE, mask, MASK_WORDS * word_bits,
+                    MPOL_MF_MOVE_FLAG) != 0 )
+                return false;
+
+            buffer_node = node;
+
+            return true;
+        #else
+            (void)node;
+            return false;
+        #endif
+        }
+
+        /**
+         * @brief Returns the NUMA node where the buffer is placed (the node
+         * given to the last successful bind() call, or the node of the
+         * constructing thread).
+         *
+         * @return int NUMA node number, or -1 if it is unknown.
+         */
+        int node() const
+        {
+            return buffer_node;
+        }
+
+        /**
+         * @brief Returns the NUMA node of the CPU where the calling thread
+         * is running.
+         *
+         * @return int NUMA node number, or -1 if it is unknown.
+         */
+        static int current_node()
+        {
+        #if defined(__linux__) && defined(SYS_getcpu)
+            unsigned cpu, node;
+
+            if ( syscall(SYS_getcpu, &cpu, &node, nullptr) != 0 )
+                return -1;
+
+            return static_cast<int>(node);
+        #else
+            return -1;
+        #endif
+        }
+
+        /**
+         * @brief Returns reference to the element at the given buffer
+         * position.
+         */
+        T_ELEMENTS& operator[](size_t i) { return elements[i]; }
+        const T_ELEMENTS& operator[](size_t i) const { return elements[i]; }
+
+        /**
+         * @brief Returns the number of elements of the buffer (0 if the
+         * mapping has failed).
+         */
+        uint64_t capacity() const
+        {
+            return ( elements != nullptr ) ? STORAGE_SIZE : 0U;
+        }
+
+    /*********************************/
+
+    private:
+
+        /* Private Constants */
+
+        /**
+         * @brief Number of words of the nodes mask (up to 1024 nodes).
+         */
+        static const size_t MASK_WORDS = 1024U / (8U * sizeof(unsigned long));
+
+        /**
+         * @brief Memory policy mode to allocate only on the given nodes
+         * (MPOL_BIND of the Linux numaif.h header).
+         */
+        static const int MPOL_BIND_MODE = 2;
+
+        /**
+         * @brief Flag to move the pages already placed on other nodes
+         * (MPOL_MF_MOVE of the Linux numaif.h header).
+         */
+        static const unsigned MPOL_MF_MOVE_FLAG = 1U << 1;
+
+        /* Private Attributes */
+
+        /**
+         * @brief Elements buffer address (nullptr if not mapped).
+         */
+        T_ELEMENTS* elements;
+
+        /**
+         * @brief Mapping size (rounded up to the page size).
+         */
+        size_t map_bytes;
+
+        /**
+         * @brief NUMA node of the buffer (-1 if unknown).
+         */
+        int buffer_node;
+};
+
+/*****************************************************************************/
+
+#endif /* STATIC_NUMA_STORAGE_H_ */
@@ -0,0 +1,763 @@
+
+/**
+ * @file    snumqueue.hpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    17-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * A numeric SQueue that provides aggregates (sum, minimum, maximum, mean
+ * and dot product) of the elements currently stored in the Queue, so it can
+ * be used as a sliding window over a data stream (a full Queue overwrites
+ * the oldest element on each push).
+ *
+ * The aggregates are computed over the (at most two) contiguous segments of
+ * the Queue circular buffer using SIMD instructions (SSE/AVX2) when the CPU
+ * supports them, selected at runtime on the first use, with a scalar
+ * fallback for any other architecture (the SIMD kernels are only built for
+ * x86-64 with GCC or Clang). The SIMD support can be disabled by
+ * defining SQUEUE_NO_SIMD before including this file.
+ *
+ * Supported element types are float and int32_t. The Queue size and storage
+ * policy template parameters are the SQueue ones, so any SQueue capacity and
+ * storage (i.e. runtime size span storage) can be used.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2022 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#ifndef STATIC_NUM_QUEUE_H_
+#define STATIC_NUM_QUEUE_H_
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ libraries
+#include <cstddef>
+#include <cstdint>
+
+// Static Queue
+#include "squeue.hpp"
+
+/*****************************************************************************/
+
+/* SIMD Support */
+
+#if !defined(SQUEUE_NO_SIMD) && defined(__GNUC__) && defined(__x86_64__)
+    #define SQUEUE_SIMD_X86 1
+    #include <immintrin.h>
+    #define SQUEUE_TARGET(x) __attribute__((target(x)))
+#endif
+
+/*****************************************************************************/
+
+/* Numeric Kernels */
+
+/**
+ * @brief Aggregate kernels over a contiguous array of elements. Only float
+ * and int32_t specializations are provided.
+ */
+template <typename T_ELEMENT>
+struct SNumKernels;
+
+template <>
+struct SNumKernels<float>
+{
+    typedef float t_sum;
+    typedef float (*t_reduce)(const float* data, size_t n);
+    typedef float (*t_dot)(const float* a, const float* b, size_t n);
+
+    /**
+     * @brief Kernels selected for the running CPU.
+     */
+    struct t_table
+    {
+        t_reduce sum;
+        t_reduce min;
+        t_reduce max;
+        t_dot dot;
+    };
+
+    /**
+     * @brief Get the kernels for the running CPU. The selection is done
+     * only on the first call.
+     */
+    static const t_table& table()
+    {
+        static const t_table selected = select();
+        return selected;
+    }
+
+    static t_table select()
+    {
+        t_table t = { sum_scalar, min_scalar, max_scalar, dot_scalar };
+    #if defined(SQUEUE_SIMD_X86)
+        __builtin_cpu_init();
+        if ( __builtin_cpu_supports("avx2") )
+        {
+            t.sum = sum_avx2; t.min = min_avx2;
+            t.max = max_avx2; t.dot = dot_avx2;
+        }
+        else if ( __builtin_cpu_supports("sse2") )
+        {
+            t.sum = sum_sse; t.min = min_sse;
+            t.max = max_sse; t.dot = dot_sse;
+        }
+    #endif
+        return t;
+    }
+
+    /* Scalar Kernels */
+
+    static float sum_scalar(const float* data, size_t n)
+    {
+        float sum = 0.0F;
+        for ( size_t i = 0U; i < n; i++ )
+            sum = sum + data[i];
+        return sum;
+    }
+
+    static float min_scalar(const float* data, size_t n)
+    {
+        float min = data[0];
+        for ( size_t i = 1U; i < n; i++ )
+            min = ( data[i] < min ) ? data[i] : min;
+        return min;
+    }
+
+    static float max_scalar(const float* data, size_t n)
+    {
+        float max = data[0];
+        for ( size_t i = 1U; i < n; i++ )
+            max = ( data[i] > max ) ? data[i] : max;
+        return max;
+    }
+
+    static float dot_scalar(const float* a, const float* b, size_t n)
+    {
+        float dot = 0.0F;
+        for ( size_t i = 0U; i < n; i++ )
+            dot = dot + (a[i] * b[i]);
+        return dot;
+    }
+
+#if defined(SQUEUE_SIMD_X86)
+
+    /* SSE Kernels */
+
+    SQUEUE_TARGET("sse2")
+    static float hsum_sse(__m128 v)
+    {
+        v = _mm_add_ps(v, _mm_movehl_ps(v, v));
+        v = _mm_add_ss(v, _mm_shuffle_ps(v, v, 0x55));
+        return _mm_cvtss_f32(v);
+    }
+
+    SQUEUE_TARGET("sse2")
+    static float sum_sse(const float* data, size_t n)
+    {
+        __m128 acc = _mm_setzero_ps();
+        size_t i = 0U;
+        for ( ; i + 4U <= n; i += 4U )
+            acc = _mm_add_ps(acc, _mm_loadu_ps(data + i));
+        return hsum_sse(acc) + sum_scalar(data + i, n - i);
+    }
+
+    SQUEUE_TARGET("sse2")
+    static float min_sse(const float* data, size_t n)
+    {
+        float result;
+        size_t i = 4U;
+        if ( n < 4U )
+            return min_scalar(data, n);
+        __m128 acc = _mm_loadu_ps(data);
+        for ( ; i + 4U <= n; i += 4U )
+            acc = _mm_min_ps(acc, _mm_loadu_ps(data + i));
+        acc = _mm_min_ps(acc, _mm_movehl_ps(acc, acc));
+        acc = _mm_min_ss(acc, _mm_shuffle_ps(acc, acc, 0x55));
+        result = _mm_cvtss_f32(acc);
+        if ( i < n )
+        {
+            float tail = min_scalar(data + i, n - i);
+            result = ( tail < result ) ? tail : result;
+        }
+        return result;
+    }
+
+    SQUEUE_TARGET("sse2")
+    static float max_sse(const float* data, size_t n)
+    {
+        float result;
+        size_t i = 4U;
+        if ( n < 4U )
+            return max_scalar(data, n);
+        __m128 acc = _mm_loadu_ps(data);
+        for ( ; i + 4U <= n; i += 4U )
+            acc = _mm_max_ps(acc, _mm_loadu_ps(data + i));
+        acc = _mm_max_ps(acc, _mm_movehl_ps(acc, acc));
+        acc = _mm_max_ss(acc, _mm_shuffle_ps(acc, acc, 0x55));
+        result = _mm_cvtss_f32(acc);
+        if ( i < n )
+        {
+            float tail = max_scalar(data + i, n - i);
+            result = ( tail > result ) ? tail : result;
+        }
+        return result;
+    }
+
+    SQUEUE_TARGET("sse2")
+    static float dot_sse(const float* a, const float* b, size_t n)
+    {
+        __m128 acc = _mm_setzero_ps();
+        size_t i = 0U;
+        for ( ; i + 4U <= n; i += 4U )
+        {
+            acc = _mm_add_ps(acc,
+                    _mm_mul_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+        }
+        return hsum_sse(acc) + dot_scalar(a + i, b + i, n - i);
+    }
+
+    /* AVX2 Kernels */
+
+    SQUEUE_TARGET("avx2")
+    static __m128 fold_avx2(__m256 v, bool is_min)
+    {
+        __m128 lo = _mm256_castps256_ps128(v);
+        __m128 hi = _mm256_extractf128_ps(v, 1);
+        return ( is_min ) ? _mm_min_ps(lo, hi) : _mm_max_ps(lo, hi);
+    }
+
+    SQUEUE_TARGET("avx2")
+    static float sum_avx2(const float* data, size_t n)
+    {
+        __m256 acc0 = _mm256_setzero_ps();
+        __m256 acc1 = _mm256_setzero_ps();
+        size_t i = 0U;
+        for ( ; i + 16U <= n; i += 16U )
+        {
+            acc0 = _mm256_add_ps(acc0, _mm256_loadu_ps(data + i));
+            acc1 = _mm256_add_ps(acc1, _mm256_loadu_ps(data + i + 8U));
+        }
+        acc0 = _mm256_add_ps(acc0, acc1);
+        __m128 acc = _mm_add_ps(_mm256_castps256_ps128(acc0),
+                _mm256_extractf128_ps(acc0, 1));
+        return hsum_sse(acc) + sum_sse(data + i, n - i);
+    }
+
+    SQUEUE_TARGET("avx2")
+    static float min_avx2(const float* data, size_t n)
+    {
+        float result;
+        size_t i = 8U;
+        if ( n < 8U )
+            return min_sse(data, n);
+        __m256 acc = _mm256_loadu_ps(data);
+        for ( ; i + 8U <= n; i += 8U )
+            acc = _mm256_min_ps(acc, _mm256_loadu_ps(data + i));
+        __m128 v = fold_avx2(acc, true);
+        v = _mm_min_ps(v, _mm_movehl_ps(v, v));
+        v = _mm_min_ss(v, _mm_shuffle_ps(v, v, 0x55));
+        result = _mm_cvtss_f32(v);
+        if ( i < n )
+        {
+            float tail = min_scalar(data + i, n - i);
+            result = ( tail < result ) ? tail : result;
+        }
+        return result;
+    }
+
+    SQUEUE_TARGET("avx2")
+    static float max_avx2(const float* data, size_t n)
+    {
+        float result;
+        size_t i = 8U;
+        if ( n < 8U )
+            return max_sse(data, n);
+        __m256 acc = _mm256_loadu_ps(data);
+        for ( ; i + 8U <= n; i += 8U )
+            acc = _mm256_max_ps(acc, _mm256_loadu_ps(data + i));
+        __m128 v = fold_avx2(acc, false);
+        v = _mm_max_ps(v, _mm_movehl_ps(v, v));
+        v = _mm_max_ss(v, _mm_shuffle_ps(v, v, 0x55));
+        result = _mm_cvtss_f32(v);
+        if ( i < n )
+        {
+            float tail = max_scalar(data + i, n - i);
+            result = ( tail > result ) ? tail : result;
+        }
+        return result;
+    }
+
+    SQUEUE_TARGET("avx2")
+    static float dot_avx2(const float* a, const float* b, size_t n)
+    {
+        __m256 acc = _mm256_setzero_ps();
+        size_t i = 0U;
+        for ( ; i + 8U <= n; i += 8U )
+        {
+            acc = _mm256_add_ps(acc, _mm256_mul_ps(
+                    _mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i)));
+        }
+        __m128 v = _mm_add_ps(_mm256_castps256_ps128(acc),
+                _mm256_extractf128_ps(acc, 1));
+        return hsum_sse(v) + dot_scalar(a + i, b + i, n - i);
+    }
+
+#endif /* SQUEUE_SIMD_X86 */
+};
+
+template <>
+struct SNumKernels<int32_t>
+{
+    typedef int64_t t_sum;
+    typedef int64_t (*t_sum_fn)(const int32_t* data, size_t n);
+    typedef int32_t (*t_reduce)(const int32_t* data, size_t n);
+    typedef int64_t (*t_dot)(const int32_t* a, const int32_t* b, size_t n);
+
+    /**
+     * @brief Kernels selected for the running CPU.
+     */
+    struct t_table
+    {
+        t_sum_fn sum;
+        t_reduce min;
+        t_reduce max;
+        t_dot dot;
+    };
+
+    /**
+     * @brief Get the kernels for the running CPU. The selection is done
+     * only on the first call.
+     */
+    static const t_table& table()
+    {
+        static const t_table selected = select();
+        return selected;
+    }
+
+    static t_table select()
+    {
+        t_table t = { sum_scalar, min_scalar, max_scalar, dot_scalar };
+    #if defined(SQUEUE_SIMD_X86)
+        __builtin_cpu_init();
+        if ( __builtin_cpu_supports("avx2") )
+        {
+            t.sum = sum_avx2; t.min = min_avx2;
+            t.max = max_avx2; t.dot = dot_avx2;
+        }
+        else if ( __builtin_cpu_supports("sse4.1") )
+        {
+            t.sum = sum_sse; t.min = min_sse;
+            t.max = max_sse; t.dot = dot_sse;
+        }
+    #endif
+        return t;
+    }
+
+    /* Scalar Kernels */
+
+    static int64_t sum_scalar(const int32_t* data, size_t n)
+    {
+        int64_t sum = 0;
+        for ( size_t i = 0U; i < n; i++ )
+            sum = sum + data[i];
+        return sum;
+    }
+
+    static int32_t min_scalar(const int32_t* data, size_t n)
+    {
+        int32_t min = data[0];
+        for ( size_t i = 1U; i < n; i++ )
+            min = ( data[i] < min ) ? data[i] : min;
+        return min;
+    }
+
+    static int32_t max_scalar(const int32_t* data, size_t n)
+    {
+        int32_t max = data[0];
+        for ( size_t i = 1U; i < n; i++ )
+            max = ( data[i] > max ) ? data[i] : max;
+        return max;
+    }
+
+    static int64_t dot_scalar(const int32_t* a, const int32_t* b, size_t n)
+    {
+        int64_t dot = 0;
+        for ( size_t i = 0U; i < n; i++ )
+            dot = dot + (static_cast<int64_t>(a[i]) * b[i]);
+        return dot;
+    }
+
+#if defined(SQUEUE_SIMD_X86)
+
+    /* SSE Kernels (SSE4.1) */
+
+    SQUEUE_TARGET("sse4.1")
+    static int64_t hsum_sse(__m128i v)
+    {
+        return _mm_extract_epi64(v, 0) + _mm_extract_epi64(v, 1);
+    }
+
+    SQUEUE_TARGET("sse4.1")
+    static int64_t sum_sse(const int32_t* data, size_t n)
+    {
+        __m128i acc = _mm_setzero_si128();
+        size_t i = 0U;
+        for ( ; i + 4U <= n; i += 4U )
+        {
+            __m128i v = _mm_loadu_si128(
+                    reinterpret_cast<const __m128i*>(data + i));
+            acc = _mm_add_epi64(acc, _mm_cvtepi32_epi64(v));
+            acc = _mm_add_epi64(acc, _mm_cvtepi32_epi64(
+                    _mm_unpackhi_epi64(v, v)));
+        }
+        return hsum_sse(acc) + sum_scalar(data + i, n - i);
+    }
+
+    SQUEUE_TARGET("sse4.1")
+    static int32_t min_sse(const int32_t* data, size_t n)
+    {
+        int32_t result;
+        size_t i = 4U;
+        if ( n < 4U )
+            return min_scalar(data, n);
+        __m128i acc = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+        for ( ; i + 4U <= n; i += 4U )
+        {
+            acc = _mm_min_epi32(acc, _mm_loadu_si128(
+                    reinterpret_cast<const __m128i*>(data + i)));
+        }
+        acc = _mm_min_epi32(acc, _mm_shuffle_epi32(acc, 0x4E));
+        acc = _mm_min_epi32(acc, _mm_shuffle_epi32(acc, 0xB1));
+        result = _mm_cvtsi128_si32(acc);
+        if ( i < n )
+        {
+            int32_t tail = min_scalar(data + i, n - i);
+            result = ( tail < result ) ? tail : result;
+        }
+        return result;
+    }
+
+    SQUEUE_TARGET("sse4.1")
+    static int32_t max_sse(const int32_t* data, size_t n)
+    {
+        int32_t result;
+        size_t i = 4U;
+        if ( n < 4U )
+            return max_scalar(data, n);
+        __m128i acc = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+        for ( ; i + 4U <= n; i += 4U )
+        {
+            acc = _mm_max_epi32(acc, _mm_loadu_si128(
+                    reinterpret_cast<const __m128i*>(data + i)));
+        }
+        acc = _mm_max_epi32(acc, _mm_shuffle_epi32(acc, 0x4E));
+        acc = _mm_max_epi32(acc, _mm_shuffle_epi32(acc, 0xB1));
+        result = _mm_cvtsi128_si32(acc);
+        if ( i < n )
+        {
+            int32_t tail = max_scalar(data + i, n - i);
+            result = ( tail > result ) ? tail : result;
+        }
+        return result;
+    }
+
+    SQUEUE_TARGET("sse4.1")
+    static int64_t dot_sse(const int32_t* a, const int32_t* b, size_t n)
+    {
+        __m128i acc = _mm_setzero_si128();
+        size_t i = 0U;
+        for ( ; i + 4U <= n; i += 4U )
+        {
+            // Even and odd lanes are multiplied apart into 64 bits products
+            __m128i va = _mm_loadu_si128(
+                    reinterpret_cast<const __m128i*>(a + i));
+            __m128i vb = _mm_loadu_si128(
+                    reinterpret_cast<const __m128i*>(b + i));
+            acc = _mm_add_epi64(acc, _mm_mul_epi32(va, vb));
+            acc = _mm_add_epi64(acc, _mm_mul_epi32(
+                    _mm_srli_epi64(va, 32), _mm_srli_epi64(vb, 32)));
+        }
+        return hsum_sse(acc) + dot_scalar(a + i, b + i, n - i);
+    }
+
+    /* AVX2 Kernels */
+
+    SQUEUE_TARGET("avx2")
+    static int64_t hsum_avx2(__m256i v)
+    {
+        __m128i s = _mm_add_epi64(_mm256_castsi256_si128(v),
+                _mm256_extracti128_si256(v, 1));
+        return _mm_extract_epi64(s, 0) + _mm_extract_epi64(s, 1);
+    }
+
+    SQUEUE_TARGET("avx2")
+    static int64_t sum_avx2(const int32_t* data, size_t n)
+    {
+        __m256i acc = _mm256_setzero_si256();
+        size_t i = 0U;
+        for ( ; i + 8U <= n; i += 8U )
+        {
+            __m128i lo = _mm_loadu_si128(
+                    reinterpret_cast<const __m128i*>(data + i));
+            __m128i hi = _mm_loadu_si128(
+                    reinterpret_cast<const __m128i*>(data + i + 4U));
+            acc = _mm256_add_epi64(acc, _mm256_cvtepi32_epi64(lo));
+            acc = _mm256_add_epi64(acc, _mm256_cvtepi32_epi64(hi));
+        }
+        return hsum_avx2(acc) + sum_scalar(data + i, n - i);
+    }
+
+    SQUEUE_TARGET("avx2")
+    static int32_t min_avx2(const int32_t* data, size_t n)
+    {
+        int32_t result;
+        size_t i = 8U;
+        if ( n < 8U )
+            return min_sse(data, n);
+        __m256i acc = _mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(data));
+        for ( ; i + 8U <= n; i += 8U )
+        {
+            acc = _mm256_min_epi32(acc, _mm256_loadu_si256(
+                    reinterpret_cast<const __m256i*>(data + i)));
+        }
+        __m128i v = _mm_min_epi32(_mm256_castsi256_si128(acc),
+                _mm256_extracti128_si256(acc, 1));
+        v = _mm_min_epi32(v, _mm_shuffle_epi32(v, 0x4E));
+        v = _mm_min_epi32(v, _mm_shuffle_epi32(v, 0xB1));
+        result = _mm_cvtsi128_si32(v);
+        if ( i < n )
+        {
+            int32_t tail = min_scalar(data + i, n - i);
+            result = ( tail < result ) ? tail : result;
+        }
+        return result;
+    }
+
+    SQUEUE_TARGET("avx2")
+    static int32_t max_avx2(const int32_t* data, size_t n)
+    {
+        int32_t result;
+        size_t i = 8U;
+        if ( n < 8U )
+            return max_sse(data, n);
+        __m256i acc = _mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(data));
+        for ( ; i + 8U <= n; i += 8U )
+        {
+            acc = _mm256_max_epi32(acc, _mm256_loadu_si256(
+                    reinterpret_cast<const __m256i*>(data + i)));
+        }
+        __m128i v = _mm_max_epi32(_mm256_castsi256_si128(acc),
+                _mm256_extracti128_si256(acc, 1));
+        v = _mm_max_epi32(v, _mm_shuffle_epi32(v, 0x4E));
+        v = _mm_max_epi32(v, _mm_shuffle_epi32(v, 0xB1));
+        result = _mm_cvtsi128_si32(v);
+        if ( i < n )
+        {
+            int32_t tail = max_scalar(data + i, n - i);
+            result = ( tail > result ) ? tail : result;
+        }
+        return result;
+    }
+
+    SQUEUE_TARGET("avx2")
+    static int64_t dot_avx2(const int32_t* a, const int32_t* b, size_t n)
+    {
+        __m256i acc = _mm256_setzero_si256();
+        size_t i = 0U;
+        for ( ; i + 8U <= n; i += 8U )
+        {
+            // Even and odd lanes are multiplied apart into 64 bits products
+            __m256i va = _mm256_loadu_si256(
+                    reinterpret_cast<const __m256i*>(a + i));
+            __m256i vb = _mm256_loadu_si256(
+                    reinterpret_cast<const __m256i*>(b + i));
+            acc = _mm256_add_epi64(acc, _mm256_mul_epi32(va, vb));
+            acc = _mm256_add_epi64(acc, _mm256_mul_epi32(
+                    _mm256_srli_epi64(va, 32), _mm256_srli_epi64(vb, 32)));
+        }
+        return hsum_avx2(acc) + dot_scalar(a + i, b + i, n - i);
+    }
+
+#endif /* SQUEUE_SIMD_X86 */
+};
+
+/*****************************************************************************/
+
+/* Class Interface */
+
+template <typename T_QUEUE_ELEMENTS, uint64_t QUEUE_SIZE,
+        template <typename, uint64_t> class T_STORAGE = SQueueArrayStorage>
+class SNumQueue : public SQueue<T_QUEUE_ELEMENTS, QUEUE_SIZE, T_STORAGE>
+{
+    public:
+
+        /* Public Types */
+
+        typedef SQueue<T_QUEUE_ELEMENTS, QUEUE_SIZE, T_STORAGE> t_queue;
+        typedef typename t_queue::storage_type storage_type;
+        typedef typename t_queue::size_type size_type;
+        typedef SNumKernels<T_QUEUE_ELEMENTS> t_kernels;
+        typedef typename t_kernels::t_sum t_sum;
+
+        /* Public Methods */
+
+        /**
+         * @brief Construct a SNumQueue object.
+         */
+        SNumQueue() {}
+
+        /**
+         * @brief Construct a SNumQueue object that uses the given storage.
+         *
+         * @param storage Storage of the Queue elements buffer.
+         */
+        explicit SNumQueue(const storage_type& storage) : t_queue(storage) {}
+
+        /**
+         * @brief Construct a SNumQueue object that takes the given storage.
+         *
+         * @param storage Storage of the Queue elements buffer.
+         */
+        explicit SNumQueue(storage_type&& storage) :
+            t_queue(std::move(storage)) {}
+
+        /**
+         * @brief Returns the sum of the elements stored in the Queue.
+         *
+         * @return t_sum The sum of the elements (a float for float Queues
+         * and an int64_t for int32_t Queues). If the Queue is empty, 0 is
+         * returned.
+         */
+        t_sum sum() const
+        {
+            t_sum result = 0;
+            const typename t_kernels::t_table& k = t_kernels::table();
+
+            this->for_each_segment(
+                [&](const T_QUEUE_ELEMENTS* data, size_type n)
+                { result = result + k.sum(data, n); });
+
+            return result;
+        }
+
+        /**
+         * @brief Returns the minimum of the elements stored in the Queue.
+         *
+         * @return T_QUEUE_ELEMENTS The minimum element value. If the Queue
+         * is empty, 0 is returned.
+         */
+        T_QUEUE_ELEMENTS min() const
+        {
+            T_QUEUE_ELEMENTS result = 0;
+            bool first = true;
+            const typename t_kernels::t_table& k = t_kernels::table();
+
+            this->for_each_segment(
+                [&](const T_QUEUE_ELEMENTS* data, size_type n)
+                {
+                    T_QUEUE_ELEMENTS segment = k.min(data, n);
+                    if ( first || (segment < result) )
+                        result = segment;
+                    first = false;
+                });
+
+            return result;
+        }
+
+        /**
+         * @brief Returns the maximum of the elements stored in the Queue.
+         *
+         * @return T_QUEUE_ELEMENTS The maximum element value. If the Queue
+         * is empty, 0 is returned.
+         */
+        T_QUEUE_ELEMENTS max() const
+        {
+            T_QUEUE_ELEMENTS result = 0;
+            bool first = true;
+            const typename t_kernels::t_table& k = t_kernels::table();
+
+            this->for_each_segment(
+                [&](const T_QUEUE_ELEMENTS* data, size_type n)
+                {
+                    T_QUEUE_ELEMENTS segment = k.max(data, n);
+                    if ( first || (segment > result) )
+                        result = segment;
+                    first = false;
+                });
+
+            return result;
+        }
+
+        /**
+         * @brief Returns the arithmetic mean of the elements stored in the
+         * Queue.
+         *
+         * @return double The mean value. If the Queue is empty, 0 is
+         * returned.
+         */
+        double mean() const
+        {
+            if ( this->empty() )
+                return 0.0;
+
+            return static_cast<double>(sum()) / this->size();
+        }
+
+        /**
+         * @brief Returns the dot product of the elements stored in the Queue
+         * with the given array of coefficients.
+         *
+         * @param coefficients Array of at least size() values, where the
+         * first coefficient multiplies the front element of the Queue and
+         * the last one multiplies the back element.
+         *
+         * @return t_sum The dot product. If the Queue is empty, 0 is
+         * returned.
+         *
+         * @details
+         * This can be used to apply a FIR filter over the sliding window.
+         */
+        t_sum dot(const T_QUEUE_ELEMENTS* coefficients) const
+        {
+            t_sum result = 0;
+            const typename t_kernels::t_table& k = t_kernels::table();
+
+            this->for_each_segment(
+                [&](const T_QUEUE_ELEMENTS* data, size_type n)
+                {
+                    result = result + k.dot(data, coefficients, n);
+                    coefficients = coefficients + n;
+                });
+
+            return result;
+        }
+};
+
+/*****************************************************************************/
+
+#endif /* STATIC_NUM_QUEUE_H_ */
@@ -0,0 +1,695 @@
+
+/**
+ * @file    sobjectpool.hpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    17-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Static memory allocated pools of objects, to pass large elements through
+ * a Queue without copying them: the producer acquires a free object of the
+ * pool, fills it in place and pushes just its 32 bits handle to a Queue of
+ * handles, and the consumer releases the object when it has been used.
+ *
+ * Components:
+ * - SObjectPool: single thread pool, with a free list of object indexes.
+ * - SAtomicObjectPool: lock-free pool that can be used from any number of
+ *   threads at the same time (i.e. producers and consumer threads of a
+ *   Queue of handles), with the free list as a Treiber stack. Its head is
+ *   a 64 bits word with the first free index and a tag that is incremented
+ *   on each change, to avoid the ABA problem.
+ * - SPooledQueue: a SObjectPool paired with a SQueue of handles, with the
+ *   interface of a Queue of in place constructed elements.
+ * - SPooledMpscQueue: the lock-free version of SPooledQueue, a
+ *   SAtomicObjectPool paired with a SIntrusiveMpscQueue of handle links,
+ *   for any number of producer threads and a single consumer thread.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2022 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#ifndef STATIC_OBJECT_POOL_H_
+#define STATIC_OBJECT_POOL_H_
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ libraries
+#include <atomic>
+#include <cstdint>
+
+// Static Queue
+#include "squeue.hpp"
+
+// Intrusive Queues
+#include "sintrusivequeue.hpp"
+
+/*****************************************************************************/
+
+/* Data Types */
+
+/**
+ * @brief Handle of a pool object (its index in the pool).
+ */
+typedef uint32_t t_pool_handle;
+
+#define SPOOL_INVALID_HANDLE 0xFFFFFFFFU
+
+/*****************************************************************************/
+
+/* Class Interface */
+
+template <typename T_OBJECTS, uint32_t POOL_SIZE>
+class SObjectPool
+{
+    static_assert((POOL_SIZE > 0U) && (POOL_SIZE < SPOOL_INVALID_HANDLE),
+            "Pool size must be greater than 0 and lower than 2^32-1");
+
+    public:
+
+        /* Public Methods */
+
+        /**
+         * @brief Construct a SObjectPool object with all its objects free.
+         */
+        SObjectPool()
+        {
+            clear();
+        }
+
+        /**
+         * @brief Releases all the objects of the pool.
+         */
+        void clear()
+        {
+            for ( uint32_t i = 0U; i < POOL_SIZE; i++ )
+                next_free[i] = i + 1U;
+            next_free[POOL_SIZE - 1U] = SPOOL_INVALID_HANDLE;
+            free_head = 0U;
+            free_count = POOL_SIZE;
+        }
+
+        /**
+         * @brief Returns the number of free objects of the pool.
+         *
+         * @return uint32_t The number of free objects.
+         */
+        uint32_t available() const
+        {
+            return free_count;
+        }
+
+        /**
+         * @brief Takes a free object from the pool.
+         *
+         * @return t_pool_handle Handle of the object. If there is no free
+         * objects, SPOOL_INVALID_HANDLE is returned.
+         *
+         * @details
+         * The object keeps the value it had when it was released, so it
+         * must be fully written by the caller.
+         */
+        t_pool_handle acquire()
+        {
+            t_pool_handle handle = free_head;
+
+            if ( handle == SPOOL_INVALID_HANDLE )
+                return SPOOL_INVALID_HANDLE;
+
+            free_head = next_free[handle];
+            free_count = free_count - 1U;
+
+            return handle;
+        }
+
+        /**
+         * @brief Returns reference to the object of a handle.
+         *
+         * @param handle Handle of the object.
+         *
+         * @return T_OBJECTS* Reference to the object. If the handle is out
+         * of the pool range, a nullptr is returned.
+         */
+        T_OBJECTS* get(t_pool_handle handle)
+        {
+            if ( handle >= POOL_SIZE )
+                return nullptr;
+
+            return &(objects[handle]);
+        }
+
+        /**
+         * @brief Returns the handle of an object of the pool.
+         *
+         * @param object Reference to the object.
+         *
+         * @return t_pool_handle Handle of the object. If the object is not
+         * part of the pool, SPOOL_INVALID_HANDLE is returned.
+         */
+        t_pool_handle handle(const T_OBJECTS* object) const
+        {
+            if ( (object < &(objects[0])) ||
+                 (object >= &(objects[0]) + POOL_SIZE) )
+                return SPOOL_INVALID_HANDLE;
+
+            return static_cast<t_pool_handle>(object - &(objects[0]));
+        }
+
+        /**
+         * @brief Returns an object to the pool.
+         *
+         * @param handle Handle of the object.
+         *
+         * @return true if the object has been released.
+         *
+         * @return false if the handle is out of the pool range.
+         *
+         * @details
+         * An object must be released just once after each acquire, a double
+         * release corrupts the free list.
+         */
+        bool release(t_pool_handle handle)
+        {
+            if ( handle >= POOL_SIZE )
+                return false;
+
+            next_free[handle] = free_head;
+            free_head = handle;
+            free_count = free_count + 1U;
+
+            return true;
+        }
+
+    /*********************************/
+
+    private:
+
+        /* Private Attributes */
+
+        /**
+         * @brief Pool objects.
+         */
+        T_OBJECTS objects[POOL_SIZE];
+
+        /**
+         * @brief Next free object index of each free object.
+         */
+        t_pool_handle next_free[POOL_SIZE];
+
+        /**
+         * @brief First free object index.
+         */
+        t_pool_handle free_head;
+
+        /**
+         * @brief Number of free objects.
+         */
+        uint32_t free_count;
+};
+
+/*****************************************************************************/
+
+template <typename T_OBJECTS, uint32_t POOL_SIZE>
+class SAtomicObjectPool
+{
+    static_assert((POOL_SIZE > 0U) && (POOL_SIZE < SPOOL_INVALID_HANDLE),
+            "Pool size must be greater than 0 and lower than 2^32-1");
+
+    public:
+
+        /* Public Methods */
+
+        /**
+         * @brief Construct a SAtomicObjectPool object with all its objects
+         * free.
+         */
+        SAtomicObjectPool()
+        {
+            for ( uint32_t i = 0U; i < POOL_SIZE; i++ )
+                next_free[i].store(i + 1U, std::memory_order_relaxed);
+            next_free[POOL_SIZE - 1U].store(SPOOL_INVALID_HANDLE,
+                    std::memory_order_relaxed);
+            free_count.store(POOL_SIZE, std::memory_order_relaxed);
+            free_head.store(0U, std::memory_order_release);
+        }
+
+        /**
+         * @brief Returns the number of free objects of the pool.
+         *
+         * @return uint32_t The number of free objects. If other threads are
+         * using the pool, it could change as soon as it is returned.
+         */
+        uint32_t available() const
+        {
+            return free_count.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Takes a free object from the pool. Thread safe.
+         *
+         * @return t_pool_handle Handle of the object. If there is no free
+         * objects, SPOOL_INVALID_HANDLE is returned.
+         */
+        t_pool_handle acquire()
+        {
+            uint64_t head = free_head.load(std::memory_order_acquire);
+            uint64_t new_head;
+            t_pool_handle handle;
+
+            do
+            {
+                handle = static_cast<t_pool_handle>(head);
+                if ( handle == SPOOL_INVALID_HANDLE )
+                    return SPOOL_INVALID_HANDLE;
+
+                // The next index could be stale, then the tag check fails
+                new_head = next_tag(head) |
+                        next_free[handle].load(std::memory_order_relaxed);
+            } while ( !free_head.compare_exchange_weak(head, new_head,
+                    std::memory_order_acquire, std::memory_order_acquire) );
+            free_count.fetch_sub(1U, std::memory_order_relaxed);
+
+            return handle;
+        }
+
+        /**
+         * @brief Returns reference to the object of a handle.
+         *
+         * @param handle Handle of the object.
+         *
+         * @return T_OBJECTS* Reference to the object. If the handle is out
+         * of the pool range, a nullptr is returned.
+         */
+        T_OBJECTS* get(t_pool_handle handle)
+        {
+            if ( handle >= POOL_SIZE )
+                return nullptr;
+
+            return &(objects[handle]);
+        }
+
+        /**
+         * @brief Returns the handle of an object of the pool.
+         *
+         * @param object Reference to the object.
+         *
+         * @return t_pool_handle Handle of the object. If the object is not
+         * part of the pool, SPOOL_INVALID_HANDLE is returned.
+         */
+        t_pool_handle handle(const T_OBJECTS* object) const
+        {
+            if ( (object < &(objects[0])) ||
+                 (object >= &(objects[0]) + POOL_SIZE) )
+                return SPOOL_INVALID_HANDLE;
+
+            return static_cast<t_pool_handle>(object - &(objects[0]));
+        }
+
+        /**
+         * @brief Returns an object to the pool. Thread safe.
+         *
+         * @param handle Handle of the object.
+         *
+         * @return true if the object has been released.
+         *
+         * @return false if the handle is out of the pool range.
+         *
+         * @details
+         * The release ordering makes the object writes of the releasing
+         * thread visible to the thread that acquires it next.
+         */
+        bool release(t_pool_handle handle)
+        {
+            uint64_t head = free_head.load(std::memory_order_relaxed);
+
+            if ( handle >= POOL_SIZE )
+                return false;
+
+            // Counted before it can be acquired again, so it never wraps
+            free_count.fetch_add(1U, std::memory_order_relaxed);
+            do
+            {
+                next_free[handle].store(static_cast<t_pool_handle>(head),
+                        std::memory_order_relaxed);
+            } while ( !free_head.compare_exchange_weak(head,
+                    next_tag(head) | handle, std::memory_order_release,
+                    std::memory_order_relaxed) );
+
+            return true;
+        }
+
+    /*********************************/
+
+    private:
+
+        /* Private Attributes */
+
+        /**
+         * @brief Pool objects.
+         */
+        T_OBJECTS objects[POOL_SIZE];
+
+        /**
+         * @brief Next free object index of each free object.
+         */
+        std::atomic<t_pool_handle> next_free[POOL_SIZE];
+
+        /**
+         * @brief Free list head: first free object index (low 32 bits) and
+         * change counter tag (high 32 bits).
+         */
+        std::atomic<uint64_t> free_head;
+
+        /**
+         * @brief Number of free objects.
+         */
+        std::atomic<uint32_t> free_count;
+
+        /******************************/
+
+        /* Private Methods */
+
+        /**
+         * @brief Get the incremented tag of a free list head.
+         * @param head Free list head.
+         * @return uint64_t The next tag, in the high 32 bits.
+         */
+        static uint64_t next_tag(uint64_t head)
+        {
+            return (head & 0xFFFFFFFF00000000ULL) + 0x100000000ULL;
+        }
+};
+
+/*****************************************************************************/
+
+template <typename T_QUEUE_ELEMENTS, uint32_t QUEUE_SIZE>
+class SPooledQueue
+{
+    public:
+
+        /* Public Methods */
+
+        /**
+         * @brief Takes a free element to be filled in place and pushed.
+         *
+         * @return T_QUEUE_ELEMENTS* Reference to the element. If all the
+         * elements are in use (the Queue is full), a nullptr is returned.
+         */
+        T_QUEUE_ELEMENTS* acquire()
+        {
+            return pool.get(pool.acquire());
+        }
+
+        /**
+         * @brief Pushes an element taken with acquire() to the end of the
+         * Queue (just its handle is stored in the Queue).
+         *
+         * @param element Reference to the element.
+         *
+         * @return true if the element has been pushed.
+         *
+         * @return false if the element is not part of the Queue pool.
+         *
+         * @details
+         * There are as many handles in the Queue as pool elements, so the
+         * Queue can never overflow.
+         */
+        bool push(T_QUEUE_ELEMENTS* element)
+        {
+            t_pool_handle handle = pool.handle(element);
+
+            if ( handle == SPOOL_INVALID_HANDLE )
+                return false;
+
+            handles.push(handle);
+
+            return true;
+        }
+
+        /**
+         * @brief Returns an element taken with acquire() to the pool without
+         * pushing it.
+         *
+         * @param element Reference to the element.
+         */
+        void discard(T_QUEUE_ELEMENTS* element)
+        {
+            pool.release(pool.handle(element));
+        }
+
+        /**
+         * @brief Check if the Queue is empty.
+         *
+         * @return true if the Queue is empty.
+         *
+         * @return false otherwise.
+         */
+        bool empty() const
+        {
+            return handles.empty();
+        }
+
+        /**
+         * @brief Returns the number of elements currently stored in the
+         * Queue.
+         *
+         * @return uint32_t The number of elements in the Queue.
+         */
+        uint32_t size() const
+        {
+            return static_cast<uint32_t>(handles.size());
+        }
+
+        /**
+         * @brief Returns reference to the first element in the Queue.
+         *
+         * @return T_QUEUE_ELEMENTS* Reference to the first element. If there
+         * is no elements on the Queue, a nullptr is returned.
+         */
+        T_QUEUE_ELEMENTS* front()
+        {
+            if ( handles.empty() )
+                return nullptr;
+
+            return pool.get(*(handles.front()));
+        }
+
+        /**
+         * @brief Removes the first element of the Queue, returning it to the
+         * pool. If the Queue is empty, do nothing.
+         */
+        void pop()
+        {
+            if ( handles.empty() )
+                return;
+
+            pool.release(*(handles.front()));
+            handles.pop();
+        }
+
+    /*********************************/
+
+    private:
+
+        /* Private Attributes */
+
+        /**
+         * @brief Pool of the Queue elements.
+         */
+        SObjectPool<T_QUEUE_ELEMENTS, QUEUE_SIZE> pool;
+
+        /**
+         * @brief Queue of the elements handles.
+         */
+        SQueue<t_pool_handle, QUEUE_SIZE> handles;
+};
+
+/*****************************************************************************/
+
+template <typename T_QUEUE_ELEMENTS, uint32_t QUEUE_SIZE>
+class SPooledMpscQueue
+{
+    public:
+
+        /* Public Methods */
+
+        /**
+         * @brief Construct a SPooledMpscQueue object with all its elements
+         * free.
+         */
+        SPooledMpscQueue()
+        {
+            for ( uint32_t i = 0U; i < QUEUE_SIZE; i++ )
+                links[i].handle = i;
+            consumer_front = nullptr;
+        }
+
+        SPooledMpscQueue(const SPooledMpscQueue&) = delete;
+        SPooledMpscQueue& operator=(const SPooledMpscQueue&) = delete;
+
+        /**
+         * @brief Takes a free element to be filled in place and pushed.
+         * Producer side, it can be called from any thread.
+         *
+         * @return T_QUEUE_ELEMENTS* Reference to the element. If all the
+         * elements are in use, a nullptr is returned.
+         */
+        T_QUEUE_ELEMENTS* acquire()
+        {
+            return pool.get(pool.acquire());
+        }
+
+        /**
+         * @brief Pushes an element taken with acquire() to the end of the
+         * Queue. Producer side, it can be called from any thread.
+         *
+         * @param element Reference to the element.
+         *
+         * @return true if the element has been pushed.
+         *
+         * @return false if the element is not part of the Queue pool.
+         *
+         * @details
+         * Each element has its own link, so the Queue can never overflow
+         * and a push is wait-free.
+         */
+        bool push(T_QUEUE_ELEMENTS* element)
+        {
+            t_pool_handle handle = pool.handle(element);
+
+            if ( handle == SPOOL_INVALID_HANDLE )
+                return false;
+
+            handles.push(&(links[handle]));
+
+            return true;
+        }
+
+        /**
+         * @brief Returns an element taken with acquire() to the pool without
+         * pushing it. It can be called from any thread.
+         *
+         * @param element Reference to the element.
+         */
+        void discard(T_QUEUE_ELEMENTS* element)
+        {
+            pool.release(pool.handle(element));
+        }
+
+        /**
+         * @brief Returns the number of free elements. If other threads are
+         * using the Queue, it could change as soon as it is returned.
+         *
+         * @return uint32_t The number of elements that can be acquired.
+         */
+        uint32_t available() const
+        {
+            return pool.available();
+        }
+
+        /**
+         * @brief Check if the Queue is empty. Consumer side.
+         *
+         * @return true if the Queue is empty (it could be in the middle of
+         * a push).
+         *
+         * @return false otherwise.
+         */
+        bool empty() const
+        {
+            return ( (consumer_front == nullptr) && handles.empty() );
+        }
+
+        /**
+         * @brief Returns reference to the first element in the Queue.
+         * Consumer side.
+         *
+         * @return T_QUEUE_ELEMENTS* Reference to the first element. If there
+         * is no elements on the Queue, or the next element push is still in
+         * progress in other thread, a nullptr is returned.
+         */
+        T_QUEUE_ELEMENTS* front()
+        {
+            if ( consumer_front == nullptr )
+                consumer_front = handles.pop();
+            if ( consumer_front == nullptr )
+                return nullptr;
+
+            return pool.get(consumer_front->handle);
+        }
+
+        /**
+         * @brief Removes the first element of the Queue, returning it to the
+         * pool. Consumer side. If the Queue is empty, do nothing.
+         */
+        void pop()
+        {
+            if ( front() == nullptr )
+                return;
+
+            pool.release(consumer_front->handle);
+            consumer_front = nullptr;
+        }
+
+    /*********************************/
+
+    private:
+
+        /* Private Data Types */
+
+        /**
+         * @brief Queue link of a pool element.
+         */
+        struct t_link : public SMpscQueueHook
+        {
+            t_pool_handle handle;
+        };
+
+        /* Private Attributes */
+
+        /**
+         * @brief Pool of the Queue elements.
+         */
+        SAtomicObjectPool<T_QUEUE_ELEMENTS, QUEUE_SIZE> pool;
+
+        /**
+         * @brief Queue link of each pool element.
+         */
+        t_link links[QUEUE_SIZE];
+
+        /**
+         * @brief Queue of the links of the pushed elements.
+         */
+        SIntrusiveMpscQueue<t_link> handles;
+
+        /**
+         * @brief Link of the front element, unlinked from the Queue but not
+         * popped yet. Only used by the consumer.
+         */
+        t_link* consumer_front;
+};
+
+/*****************************************************************************/
+
+#endif /* STATIC_OBJECT_POOL_H_ */
@@ -0,0 +1,307 @@
+
+/**
+ * @file    spriorityqueue.hpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    17-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * A static memory allocated priority Queue of any kind of data type
+ * elements, where the first element is always the one with the highest
+ * priority instead of the oldest one (i.e. control messages ahead of data
+ * messages).
+ *
+ * The elements are stored in a d-ary heap (4 children per node by default)
+ * over a fixed array. Compared with a binary heap, the tree has half the
+ * levels and the children of a node are contiguous in memory, so a pop
+ * needs fewer cache lines. As in std::priority_queue, the compare function
+ * returns true if its first argument has lower priority than the second
+ * one, so with std::less the greatest element is the first one.
+ *
+ * The behaviour of a push in a full Queue is selected with the overflow
+ * policy template parameter:
+ * - PRIORITY_DROP_LOWEST: as SQueue, the push is always done and the
+ *   element with the lowest priority (that can be the new one) is dropped.
+ *   Finding it requires a scan of the heap leaves.
+ * - PRIORITY_REJECT: the new element is discarded.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2022 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#ifndef STATIC_PRIORITY_QUEUE_H_
+#define STATIC_PRIORITY_QUEUE_H_
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ libraries
+#include <cstdint>
+#include <functional>
+#include <utility>
+
+// Static Queue
+#include "squeue.hpp"
+
+/*****************************************************************************/
+
+/* Data Types */
+
+typedef enum t_priority_overflow
+{
+    PRIORITY_DROP_LOWEST = 0,
+    PRIORITY_REJECT      = 1,
+} t_priority_overflow;
+
+/*****************************************************************************/
+
+/* Class Interface */
+
+template <typename T_QUEUE_ELEMENTS, uint32_t QUEUE_SIZE,
+        typename T_COMPARE = std::less<T_QUEUE_ELEMENTS>,
+        t_priority_overflow OVERFLOW_POLICY = PRIORITY_DROP_LOWEST,
+        uint32_t HEAP_ARITY = 4U>
+class SPriorityQueue
+{
+    static_assert(QUEUE_SIZE > 0U, "Queue size must be greater than 0");
+    static_assert(HEAP_ARITY >= 2U, "Heap arity must be at least 2");
+
+    public:
+
+        /* Public Methods */
+
+        /**
+         * @brief Construct a SPriorityQueue object.
+         *
+         * @param compare Compare function object.
+         */
+        explicit SPriorityQueue(const T_COMPARE& compare = T_COMPARE()) :
+            lower_priority(compare)
+        {
+            clear();
+        }
+
+        /**
+         * @brief Clear the Queue.
+         */
+        void clear()
+        {
+            heap_size = 0U;
+        }
+
+        /**
+         * @brief Check if the Queue is empty.
+         *
+         * @return true if the Queue is empty.
+         *
+         * @return false otherwise.
+         */
+        bool empty() const
+        {
+            return ( heap_size == 0U );
+        }
+
+        /**
+         * @brief Returns the number of elements currently stored in the
+         * Queue.
+         *
+         * @return uint32_t The number of elements in the Queue.
+         */
+        uint32_t size() const
+        {
+            return heap_size;
+        }
+
+        /**
+         * @brief Returns reference to the element with the highest priority.
+         *
+         * @return T_QUEUE_ELEMENTS* Reference to the element. If there is no
+         * elements on the Queue, a nullptr is returned.
+         */
+        T_QUEUE_ELEMENTS* top()
+        {
+            if ( empty() )
+                return nullptr;
+
+            return &(heap[0]);
+        }
+
+        /**
+         * @brief Pushes the given element value into the Queue.
+         *
+         * @param element The value of the element to push.
+         *
+         * @return t_overflow BUFFER_OVERFLOW if the Queue was full and an
+         * element has been dropped (the lowest priority one or the new one,
+         * depending on the overflow policy), BUFFER_OK otherwise.
+         */
+        t_overflow push(const T_QUEUE_ELEMENTS& element)
+        {
+            uint32_t lowest;
+
+            if ( heap_size < QUEUE_SIZE )
+            {
+                heap[heap_size] = element;
+                heap_size = heap_size + 1U;
+                sift_up(heap_size - 1U);
+                return BUFFER_OK;
+            }
+
+            if ( OVERFLOW_POLICY == PRIORITY_REJECT )
+                return BUFFER_OVERFLOW;
+
+            // Drop the new element if it has the lowest priority
+            lowest = lowest_leaf();
+            if ( !lower_priority(heap[lowest], element) )
+                return BUFFER_OVERFLOW;
+
+            heap[lowest] = element;
+            sift_up(lowest);
+
+            return BUFFER_OVERFLOW;
+        }
+
+        /**
+         * @brief Removes the element with the highest priority. If the Queue
+         * is empty, do nothing.
+         */
+        void pop()
+        {
+            if ( empty() )
+                return;
+
+            heap_size = heap_size - 1U;
+            if ( heap_size == 0U )
+                return;
+
+            sift_down(std::move(heap[heap_size]));
+        }
+
+    /*********************************/
+
+    private:
+
+        /* Private Attributes */
+
+        /**
+         * @brief Heap of the Queue elements.
+         */
+        T_QUEUE_ELEMENTS heap[QUEUE_SIZE];
+
+        /**
+         * @brief Number of elements of the heap.
+         */
+        uint32_t heap_size;
+
+        /**
+         * @brief Compare function object.
+         */
+        T_COMPARE lower_priority;
+
+        /******************************/
+
+        /* Private Methods */
+
+        /**
+         * @brief Move an element up the heap to its position.
+         * @param i Heap position of the element.
+         */
+        void sift_up(uint32_t i)
+        {
+            T_QUEUE_ELEMENTS element = std::move(heap[i]);
+
+            while ( i > 0U )
+            {
+                uint32_t parent = (i - 1U) / HEAP_ARITY;
+
+                if ( !lower_priority(heap[parent], element) )
+                    break;
+
+                heap[i] = std::move(heap[parent]);
+                i = parent;
+            }
+
+            heap[i] = std::move(element);
+        }
+
+        /**
+         * @brief Place an element in the heap root position and move it
+         * down the heap to its position.
+         * @param element The element.
+         */
+        void sift_down(T_QUEUE_ELEMENTS&& element)
+        {
+            uint32_t i = 0U;
+
+            while ( true )
+            {
+                uint32_t first = (i * HEAP_ARITY) + 1U;
+                uint32_t last, best;
+
+                if ( first >= heap_size )
+                    break;
+
+                // Highest priority child
+                last = ( (heap_size - first) > HEAP_ARITY ) ?
+                        (first + HEAP_ARITY) : heap_size;
+                best = first;
+                for ( uint32_t c = first + 1U; c < last; c++ )
+                {
+                    if ( lower_priority(heap[best], heap[c]) )
+                        best = c;
+                }
+
+                if ( !lower_priority(element, heap[best]) )
+                    break;
+
+                heap[i] = std::move(heap[best]);
+                i = best;
+            }
+
+            heap[i] = std::move(element);
+        }
+
+        /**
+         * @brief Get the position of the lowest priority element, that is
+         * always a leaf of the heap.
+         * @return uint32_t Heap position of the element.
+         */
+        uint32_t lowest_leaf() const
+        {
+            uint32_t lowest = ( heap_size > 1U ) ?
+                    (((heap_size - 2U) / HEAP_ARITY) + 1U) : 0U;
+
+            for ( uint32_t i = lowest + 1U; i < heap_size; i++ )
+            {
+                if ( lower_priority(heap[i], heap[lowest]) )
+                    lowest = i;
+            }
+
+            return lowest;
+        }
+};
+
+/*****************************************************************************/
+
+#endif /* STATIC_PRIORITY_QUEUE_H_ */
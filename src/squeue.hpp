@@ -15,11 +15,38 @@
  *
  * The implementation of this Queue component is based on the use of a
  * circular buffer with two incremental indexes (head and tail) that returns
- * to zero when overflows on the queue maximum size. Appending a new element
- * increments the head index while removing an element increments the tail
- * index. The number of elements that are currently stored in the queue is
- * given by the difference between head and tail indexes. When the Queue is
- * full, the new elements will overwrite the older elements.
+ * to zero when overflows on two times the queue maximum size. Appending a
+ * new element increments the head index while removing an element
+ * increments the tail index. The number of elements that are currently
+ * stored in the queue is given by the difference between head and tail
+ * indexes (the indexes range is doubled to distinguish a full Queue from an
+ * empty one). When the Queue is full, the new elements will overwrite the
+ * older elements.
+ *
+ * The indexes use the smallest unsigned type that can hold their range for
+ * the Queue size (uint8_t for up to 128 elements, uint16_t for up to 32768
+ * elements, uint32_t for up to 2^31 elements and uint64_t above that), so
+ * small Queues have just a few bytes of metadata.
+ *
+ * The elements buffer is provided by a storage policy class template,
+ * given as the last template parameter of the Queue. The default one,
+ * SQueueArrayStorage, is an array embedded in the Queue object. Any other
+ * storage policy must be a class template with the same parameters (element
+ * type and number of elements) that is default constructible, allocates
+ * its whole buffer on construction and provides indexed access to the
+ * elements (operator[]) of a contiguous buffer, and its capacity
+ * (capacity(), that is 0 if the storage has no buffer).
+ *
+ * The Queue size can also be set at runtime, giving SQUEUE_DYNAMIC_SIZE as
+ * the Queue size template parameter and a storage policy that gets its
+ * buffer from outside the Queue object (i.e. SQueueSpanStorage for a
+ * caller provided buffer or SQueueArenaStorage for a block of a memory
+ * arena). The Queue is then constructed from a storage object, whose
+ * capacity must be a power of two, so the indexes are wrapped with a mask.
+ *
+ * A storage without buffer (capacity 0, i.e. a failed allocation or
+ * mapping, for fixed and runtime size Queues) gives an always empty Queue,
+ * where every push is rejected with BUFFER_OVERFLOW.
  *
  * @section LICENSE
  *
@@ -52,7 +79,47 @@
 /* Libraries */
 
 // Standard C++ libraries
+#include <cstddef>
 #include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+/*****************************************************************************/
+
+/* Build Configuration */
+
+/**
+ * @brief Default number of elements ahead of the current one that drain()
+ * prefetches for elements larger than a cache line (it can be defined
+ * before including this file). For smaller elements the default is 0, as
+ * the hardware prefetcher already follows the sequential reads.
+ */
+#ifndef SQUEUE_PREFETCH_DISTANCE
+    #define SQUEUE_PREFETCH_DISTANCE 4U
+#endif
+
+/**
+ * @brief Maximum number of bytes of each element that drain() prefetches,
+ * one request per cache line (it can be defined before including this
+ * file).
+ */
+#ifndef SQUEUE_PREFETCH_MAX_BYTES
+    #define SQUEUE_PREFETCH_MAX_BYTES 1024U
+#endif
+
+/**
+ * @brief Cache line size assumed by the prefetch.
+ */
+#ifndef SQUEUE_CACHE_LINE_SIZE
+    #define SQUEUE_CACHE_LINE_SIZE 64U
+#endif
+
+#if defined(__GNUC__)
+    #define SQUEUE_PREFETCH(address) __builtin_prefetch((address), 0, 3)
+#else
+    #define SQUEUE_PREFETCH(address)
+#endif
 
 /*****************************************************************************/
 
@@ -64,15 +131,450 @@ typedef enum t_overflow
     BUFFER_OVERFLOW = 1,
 } t_overflow;
 
+/**
+ * @brief Header of a Queue snapshot, followed by the stored elements from
+ * the front to the back.
+ */
+typedef struct t_squeue_snapshot
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t element_size;
+    uint32_t reserved;
+    uint64_t count;
+} t_squeue_snapshot;
+
+#define SQUEUE_SNAPSHOT_MAGIC   0x53515350U /* "SQSP" */
+#define SQUEUE_SNAPSHOT_VERSION 2U
+
+/**
+ * @brief Queue size template parameter value for Queues whose size is set
+ * at runtime by their storage.
+ */
+#define SQUEUE_DYNAMIC_SIZE 0U
+
+/**
+ * @brief Index types and circular buffer index operations of a Queue of the
+ * given size.
+ *
+ * @details
+ * The circular buffer indexes range from 0 to 2*QUEUE_SIZE-1, so index_type
+ * is the smallest unsigned type that can hold that range. The size_type is
+ * used for elements counts and positions, it is the native size_t (unless
+ * the indexes range does not fit in it), so it can also hold the whole
+ * indexes range. The index_type is just the storage type of the indexes:
+ * the operations take and return size_type values, and the caller narrows
+ * an index only when it stores it, so the index computations of the loops
+ * (i.e. operator[] scans) are not truncated to the compact type and
+ * zero extended again on each element.
+ */
+template <uint64_t QUEUE_SIZE>
+struct SQueueIndex
+{
+    typedef typename std::conditional<(QUEUE_SIZE <= 0x80U), uint8_t,
+            typename std::conditional<(QUEUE_SIZE <= 0x8000U), uint16_t,
+            typename std::conditional<(QUEUE_SIZE <= 0x80000000U), uint32_t,
+            uint64_t>::type>::type>::type index_type;
+
+    typedef typename std::conditional<(QUEUE_SIZE <= (SIZE_MAX / 2U)),
+            size_t, uint64_t>::type size_type;
+
+    /**
+     * @brief Maximum value of the circular buffer indexes.
+     */
+    static const size_type INDEX_MAX =
+            static_cast<size_type>((2U * QUEUE_SIZE) - 1U);
+
+    /**
+     * @brief The Queue size is a power of two, so the indexes can be
+     * wrapped with a mask.
+     */
+    static const bool IS_POW2 = ( (QUEUE_SIZE & (QUEUE_SIZE - 1U)) == 0U );
+
+    /**
+     * @brief Advance a circular buffer index.
+     *
+     * @param index Index to advance.
+     *
+     * @param n Number of positions to advance (up to QUEUE_SIZE).
+     *
+     * @param capacity Unused, the Queue size is fixed (it is given just
+     * for compatibility with the runtime size indexes).
+     *
+     * @return size_type The advanced index, in the range 0 to
+     * 2*QUEUE_SIZE-1.
+     *
+     * @details
+     * For power of two sizes the index is wrapped with a mask, otherwise
+     * with a comparison instead of a module operation (the sum can not be
+     * greater than 3*QUEUE_SIZE-1), that is also written to avoid
+     * overflowing the size type.
+     */
+    static size_type advance(size_type index, size_type n,
+            size_type capacity = QUEUE_SIZE)
+    {
+        (void)capacity;
+
+        if ( IS_POW2 )
+            return (index + n) & INDEX_MAX;
+
+        if ( n > (INDEX_MAX - index) )
+            return n - (INDEX_MAX - index) - 1U;
+
+        return index + n;
+    }
+
+    /**
+     * @brief Get the buffer position of a circular buffer index.
+     *
+     * @param index Circular buffer index.
+     *
+     * @param capacity Unused, the Queue size is fixed.
+     *
+     * @return size_type The buffer position (range 0 to QUEUE_SIZE-1).
+     */
+    static size_type slot(size_type index, size_type capacity = QUEUE_SIZE)
+    {
+        (void)capacity;
+
+        if ( IS_POW2 )
+            return index & (INDEX_MAX >> 1);
+
+        if ( index >= QUEUE_SIZE )
+            return static_cast<size_type>(index - QUEUE_SIZE);
+
+        return index;
+    }
+
+    /**
+     * @brief Get the number of positions from a circular buffer index to
+     * another one.
+     *
+     * @param from First index.
+     *
+     * @param to Last index.
+     *
+     * @param capacity Unused, the Queue size is fixed.
+     *
+     * @return size_type The number of positions, wrapped to the indexes
+     * range.
+     */
+    static size_type distance(size_type from, size_type to,
+            size_type capacity = QUEUE_SIZE)
+    {
+        (void)capacity;
+
+        if ( IS_POW2 )
+            return (to - from) & INDEX_MAX;
+
+        if ( to >= from )
+            return to - from;
+
+        return (INDEX_MAX - from) + to + 1U;
+    }
+};
+
+/**
+ * @brief Index types and circular buffer index operations of a Queue whose
+ * size is set at runtime.
+ *
+ * @details
+ * The capacity is given to each operation and it must be a power of two,
+ * so the indexes (range 0 to 2*capacity-1) are always wrapped with a mask.
+ */
+template <>
+struct SQueueIndex<SQUEUE_DYNAMIC_SIZE>
+{
+    typedef size_t index_type;
+    typedef size_t size_type;
+
+    /**
+     * @brief Advance a circular buffer index.
+     *
+     * @param index Index to advance.
+     *
+     * @param n Number of positions to advance (up to capacity).
+     *
+     * @param capacity Queue capacity.
+     *
+     * @return index_type The advanced index, in the range 0 to
+     * 2*capacity-1.
+     */
+    static index_type advance(index_type index, size_type n,
+            size_type capacity)
+    {
+        return (index + n) & ((2U * capacity) - 1U);
+    }
+
+    /**
+     * @brief Get the buffer position of a circular buffer index.
+     *
+     * @param index Circular buffer index.
+     *
+     * @param capacity Queue capacity.
+     *
+     * @return size_type The buffer position (range 0 to capacity-1).
+     */
+    static size_type slot(index_type index, size_type capacity)
+    {
+        return index & (capacity - 1U);
+    }
+
+    /**
+     * @brief Get the number of positions from a circular buffer index to
+     * another one.
+     *
+     * @param from First index.
+     *
+     * @param to Last index.
+     *
+     * @param capacity Queue capacity.
+     *
+     * @return size_type The number of positions, wrapped to the indexes
+     * range.
+     */
+    static size_type distance(index_type from, index_type to,
+            size_type capacity)
+    {
+        return (to - from) & ((2U * capacity) - 1U);
+    }
+
+    /**
+     * @brief Round a number of elements down to a valid capacity.
+     *
+     * @param n Number of elements.
+     *
+     * @return size_type The greatest power of two not greater than n (0 if
+     * n is 0).
+     */
+    static size_type floor_capacity(size_type n)
+    {
+        size_type result = 1U;
+
+        if ( n == 0U )
+            return 0U;
+
+        while ( result <= (n >> 1) )
+            result = result << 1;
+
+        return result;
+    }
+
+    /**
+     * @brief Round a number of elements up to a valid capacity.
+     *
+     * @param n Number of elements.
+     *
+     * @return size_type The smallest power of two not lower than n (0 if n
+     * is 0 or the indexes range can not hold it).
+     */
+    static size_type ceil_capacity(size_type n)
+    {
+        size_type result = 1U;
+
+        if ( n == 0U )
+            return 0U;
+
+        while ( result < n )
+        {
+            if ( result > (static_cast<size_type>(-1) >> 2) )
+                return 0U;
+            result = result << 1;
+        }
+
+        return result;
+    }
+};
+
+/*****************************************************************************/
+
+/* Iterator Interface */
+
+/**
+ * @brief Random access iterator over the elements stored in a SQueue, from
+ * the front (oldest) element to the back (most recent) one.
+ *
+ * @details
+ * The iterator keeps a reference to the Queue and a logical position
+ * relative to the current front element, so the circular buffer wrap-around
+ * is resolved by the Queue element access operator and the iterator can be
+ * used with any standard algorithm. Any push() or pop() on the Queue shifts
+ * the element that a position refers to, so iterators must not be kept
+ * across Queue modifications. Iterators of different Queues are never
+ * equal, and they must not be ordered or subtracted.
+ */
+template <typename T_QUEUE, typename T_ELEMENT>
+class SQueueIterator
+{
+    public:
+
+        /* Iterator Traits */
+
+        typedef std::random_access_iterator_tag iterator_category;
+        typedef typename T_QUEUE::value_type value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef T_ELEMENT* pointer;
+        typedef T_ELEMENT& reference;
+
+        /* Public Methods */
+
+        /**
+         * @brief Construct a SQueueIterator object that points nowhere.
+         */
+        SQueueIterator() : queue(nullptr), position(0) {}
+
+        /**
+         * @brief Construct a SQueueIterator object that points to the given
+         * logical position (0 is the front element) of a Queue.
+         *
+         * @param iter_queue The Queue to iterate over.
+         *
+         * @param iter_position Logical position from the Queue front.
+         */
+        SQueueIterator(T_QUEUE* iter_queue, difference_type iter_position) :
+            queue(iter_queue), position(iter_position) {}
+
+        /**
+         * @brief Construct a const iterator from a mutable one.
+         *
+         * @param other The mutable iterator to copy.
+         *
+         * @details
+         * The constructor only takes part in overload resolution when the
+         * other iterator Queue and element pointers convert to this ones, so
+         * a const iterator is not convertible to a mutable one.
+         */
+        template <typename T_OTHER_QUEUE, typename T_OTHER_ELEMENT,
+                typename = typename std::enable_if<
+                std::is_convertible<T_OTHER_QUEUE*, T_QUEUE*>::value &&
+                std::is_convertible<T_OTHER_ELEMENT*, T_ELEMENT*>::value>::type>
+        SQueueIterator(
+                const SQueueIterator<T_OTHER_QUEUE, T_OTHER_ELEMENT>& other) :
+            queue(other.queue), position(other.position) {}
+
+        reference operator*() const { return (*queue)[position]; }
+        pointer operator->() const { return &((*queue)[position]); }
+        reference operator[](difference_type n) const
+        { return (*queue)[position + n]; }
+
+        SQueueIterator& operator++() { ++position; return *this; }
+        SQueueIterator& operator--() { --position; return *this; }
+        SQueueIterator operator++(int)
+        { SQueueIterator it = *this; ++position; return it; }
+        SQueueIterator operator--(int)
+        { SQueueIterator it = *this; --position; return it; }
+
+        SQueueIterator& operator+=(difference_type n)
+        { position += n; return *this; }
+        SQueueIterator& operator-=(difference_type n)
+        { position -= n; return *this; }
+        SQueueIterator operator+(difference_type n) const
+        { return SQueueIterator(queue, position + n); }
+        SQueueIterator operator-(difference_type n) const
+        { return SQueueIterator(queue, position - n); }
+        friend SQueueIterator operator+(difference_type n,
+                const SQueueIterator& it)
+        { return it + n; }
+        difference_type operator-(const SQueueIterator& other) const
+        { return position - other.position; }
+
+        bool operator==(const SQueueIterator& other) const
+        { return ( (queue == other.queue) && (position == other.position) ); }
+        bool operator!=(const SQueueIterator& other) const
+        { return !(*this == other); }
+        bool operator<(const SQueueIterator& other) const
+        { return ( position < other.position ); }
+        bool operator>(const SQueueIterator& other) const
+        { return ( position > other.position ); }
+        bool operator<=(const SQueueIterator& other) const
+        { return ( position <= other.position ); }
+        bool operator>=(const SQueueIterator& other) const
+        { return ( position >= other.position ); }
+
+    /*********************************/
+
+    private:
+
+        template <typename T_OTHER_QUEUE, typename T_OTHER_ELEMENT>
+        friend class SQueueIterator;
+
+        /* Private Attributes */
+
+        /**
+         * @brief The iterated Queue.
+         */
+        T_QUEUE* queue;
+
+        /**
+         * @brief Logical position from the Queue front element.
+         */
+        difference_type position;
+};
+
+/*****************************************************************************/
+
+/* Storage Policies */
+
+/**
+ * @brief Default Queue storage policy, the elements buffer is an array
+ * embedded in the Queue object.
+ */
+template <typename T_ELEMENTS, uint64_t STORAGE_SIZE>
+class SQueueArrayStorage
+{
+    public:
+
+        /**
+         * @brief Returns reference to the element at the given buffer
+         * position.
+         */
+        T_ELEMENTS& operator[](size_t i) { return elements[i]; }
+        const T_ELEMENTS& operator[](size_t i) const { return elements[i]; }
+
+        /**
+         * @brief Returns the number of elements of the buffer.
+         */
+        static uint64_t capacity() { return STORAGE_SIZE; }
+
+    private:
+
+        /**
+         * @brief Elements buffer.
+         */
+        T_ELEMENTS elements[STORAGE_SIZE];
+};
+
 /*****************************************************************************/
 
 /* Class Interface */
 
-template <typename T_QUEUE_ELEMENTS, uint32_t QUEUE_SIZE>
+template <typename T_QUEUE_ELEMENTS, uint64_t QUEUE_SIZE,
+        template <typename, uint64_t> class T_STORAGE = SQueueArrayStorage>
 class SQueue
 {
     public:
 
+        /* Public Types */
+
+        typedef T_QUEUE_ELEMENTS value_type;
+        typedef T_STORAGE<T_QUEUE_ELEMENTS, QUEUE_SIZE> storage_type;
+        typedef SQueueIndex<QUEUE_SIZE> t_index;
+        typedef typename t_index::size_type size_type;
+        typedef typename t_index::index_type index_type;
+        typedef SQueueIterator<SQueue, T_QUEUE_ELEMENTS> iterator;
+        typedef SQueueIterator<const SQueue, const T_QUEUE_ELEMENTS>
+                const_iterator;
+
+        /* Public Constants */
+
+        /**
+         * @brief Default drain() prefetch distance (elements that fit in a
+         * cache line are not prefetched).
+         */
+        static const size_type DEFAULT_PREFETCH_DISTANCE =
+                ( sizeof(T_QUEUE_ELEMENTS) > SQUEUE_CACHE_LINE_SIZE ) ?
+                SQUEUE_PREFETCH_DISTANCE : 0U;
+
         /* Public Methods */
 
         /**
@@ -82,7 +584,34 @@ class SQueue
         {
             queue_head = 0U;
             queue_tail = 0U;
-            num_elements_stored = 0U;
+            buffer_overflow = false;
+        }
+
+        /**
+         * @brief Construct a SQueue object that uses a copy of the given
+         * storage (for storages that can be copied; the ones that refer to
+         * an external buffer can only be moved, so two Queues never share
+         * a buffer).
+         *
+         * @param storage Storage of the Queue elements buffer.
+         */
+        explicit SQueue(const storage_type& storage) : buffer(storage)
+        {
+            queue_head = 0U;
+            queue_tail = 0U;
+            buffer_overflow = false;
+        }
+
+        /**
+         * @brief Construct a SQueue object that takes the given storage (for
+         * storages that own their buffer and can only be moved).
+         *
+         * @param storage Storage of the Queue elements buffer.
+         */
+        explicit SQueue(storage_type&& storage) : buffer(std::move(storage))
+        {
+            queue_head = 0U;
+            queue_tail = 0U;
             buffer_overflow = false;
         }
 
@@ -93,7 +622,6 @@ class SQueue
         {
             queue_head = 0U;
             queue_tail = 0U;
-            num_elements_stored = 0U;
             buffer_overflow = false;
         }
 
@@ -104,19 +632,35 @@ class SQueue
          *
          * @return false otherwise.
          */
-        bool empty()
+        bool empty() const
         {
-            return ( num_elements_stored == 0U );
+            return ( queue_head == queue_tail );
         }
 
         /**
          * @brief Returns the number of elements currently stored in the Queue.
          *
-         * @return uint32_t The number of elements in the Queue.
+         * @return size_type The number of elements in the Queue.
+         *
+         * @details
+         * The number of elements is the difference between the head and tail
+         * indexes, wrapped to the indexes range.
+         */
+        size_type size() const
+        {
+            return t_index::distance(queue_tail, queue_head, capacity());
+        }
+
+        /**
+         * @brief Returns the maximum number of elements that can be stored
+         * in the Queue (the storage capacity: QUEUE_SIZE, the runtime size
+         * of a runtime size Queue, or 0 if the storage has no buffer).
+         *
+         * @return size_type The Queue capacity.
          */
-        uint32_t size()
+        size_type capacity() const
         {
-            return num_elements_stored;
+            return static_cast<size_type>(buffer.capacity());
         }
 
         /**
@@ -134,7 +678,7 @@ class SQueue
             if ( empty() )
                 return nullptr;
             else
-                return &(buffer[(queue_tail + 1U) % QUEUE_SIZE]);
+                return &(buffer[element_index(0U)]);
         }
 
         /**
@@ -152,7 +696,7 @@ class SQueue
             if ( empty() )
                 return nullptr;
 
-            return &(buffer[queue_head]);
+            return &(buffer[t_index::slot(queue_head, capacity())]);
         }
 
         /**
@@ -165,29 +709,36 @@ class SQueue
          * @details
          * This function append a new element to the last position of Queue
          * buffer. It increments the Queues head index (new element at the
-         * next Queue back position) by using module to keep the value inside
-         * the range 0 to QUEUE_SIZE-1) and add a copy of the provided element
-         * to this new head position of the queue buffer. In case of Queue is
+         * next Queue back position, keeping the value inside the range 0 to
+         * 2*QUEUE_SIZE-1) and add a copy of the provided element to the
+         * buffer position of this new head index. In case of Queue is
          * full, the buffer overflow flag attribute is set and the tail index
          * is increased (set the oldest front element to the next one). At the
          * end, the function return if an overflow of the buffer has occurred
-         * (notifying that the oldest element has been overwritten).
+         * (notifying that the oldest element has been overwritten). If the
+         * Queue has no buffer (runtime size Queue with a capacity 0
+         * storage), the element is discarded and BUFFER_OVERFLOW is
+         * returned.
          */
         t_overflow push(T_QUEUE_ELEMENTS element)
         {
+            // Runtime size Queue without buffer, keep it empty
+            if ( no_buffer() )
+                return BUFFER_OVERFLOW;
+
             // Handle if Queue is full or not
             if ( full() )
             {
                 // Set overflow flag and remove oldest Queue element
                 buffer_overflow = true;
-                queue_tail = (queue_tail + 1U) % QUEUE_SIZE;
+                queue_tail = static_cast<index_type>(
+                        t_index::advance(queue_tail, 1U, capacity()));
             }
-            else
-                num_elements_stored = num_elements_stored + 1U;
 
             // Increase Queue back element position and add the new element
-            queue_head = (queue_head + 1U) % QUEUE_SIZE;
-            buffer[queue_head] = element;
+            queue_head = static_cast<index_type>(
+                    t_index::advance(queue_head, 1U, capacity()));
+            buffer[t_index::slot(queue_head, capacity())] = element;
 
             // Return push result on buffer overflow
             if ( buffer_overflow )
@@ -200,9 +751,8 @@ class SQueue
          * @brief Removes an element from the front of the Queue.
          * @details
          * This function remove the first element of the Queue buffer. It just
-         * increase the queue tail index (using module to keep the value
-         * inside the range 0 to QUEUE_SIZE-1). If the Queue is empty, do
-         * nothing.
+         * increase the queue tail index (keeping the value inside the range
+         * 0 to 2*QUEUE_SIZE-1). If the Queue is empty, do nothing.
          * Note: Any element pop will clear the queue overflow flag.
          */
         void pop()
@@ -210,11 +760,301 @@ class SQueue
             if ( empty() )
                 return;
 
-            queue_tail = (queue_tail + 1U) % QUEUE_SIZE;
-            num_elements_stored = num_elements_stored - 1U;
+            queue_tail = static_cast<index_type>(
+                    t_index::advance(queue_tail, 1U, capacity()));
             buffer_overflow = false;
         }
 
+        /**
+         * @brief Calls the given function for each element from the front of
+         * the Queue and removes them.
+         *
+         * @param f Function to call as f(T_QUEUE_ELEMENTS& element).
+         *
+         * @param max Maximum number of elements to remove.
+         *
+         * @param prefetch_distance Number of elements ahead of the current
+         * one to prefetch (0 to disable the prefetch). By default,
+         * SQUEUE_PREFETCH_DISTANCE for elements larger than a cache line and
+         * 0 for smaller ones.
+         *
+         * @return size_type The number of elements removed.
+         *
+         * @details
+         * While the function processes an element, the element that is
+         * prefetch_distance positions after it in the Queue is requested to
+         * the cache (each of its cache lines, up to SQUEUE_PREFETCH_MAX_BYTES
+         * bytes), so large elements are already loaded when they are
+         * reached. A consumer that reads just a few cache lines of large
+         * elements should disable the prefetch (or define a lower
+         * SQUEUE_PREFETCH_MAX_BYTES), as the requests for the lines that it
+         * does not read take memory bandwidth from the ones that it reads.
+         * The prefetched buffer positions follow the wrap around of the
+         * buffer end. The elements are removed after the function has been
+         * called for all of them, so the function must not modify the
+         * Queue. If any element is removed, the queue overflow flag is
+         * cleared.
+         */
+        template <typename T_FUNCTION>
+        size_type drain(T_FUNCTION f, size_type max = ~size_type(0U),
+                size_type prefetch_distance = DEFAULT_PREFETCH_DISTANCE)
+        {
+            size_type n = size();
+
+            if ( n > max )
+                n = max;
+
+            if ( n == 0U )
+                return 0U;
+
+            for ( size_type i = 0U; (i < prefetch_distance) && (i < n); i++ )
+                prefetch(element_index(i));
+
+            for ( size_type i = 0U; i < n; i++ )
+            {
+                if ( (prefetch_distance != 0U) &&
+                     ((n - i) > prefetch_distance) )
+                    prefetch(element_index(i + prefetch_distance));
+                f(buffer[element_index(i)]);
+            }
+
+            queue_tail = static_cast<index_type>(
+                    t_index::advance(queue_tail, n, capacity()));
+            buffer_overflow = false;
+
+            return n;
+        }
+
+        /**
+         * @brief Returns reference to the element at the given position,
+         * counting from the front of the Queue (position 0 is the front
+         * element and position size()-1 is the back element).
+         *
+         * @param i Position of the element from the Queue front.
+         *
+         * @return T_QUEUE_ELEMENTS& Reference to the element.
+         *
+         * @details
+         * This function does not check the position against the number of
+         * stored elements, use at() for a checked access.
+         */
+        T_QUEUE_ELEMENTS& operator[](size_type i)
+        {
+            return buffer[element_index(i)];
+        }
+
+        const T_QUEUE_ELEMENTS& operator[](size_type i) const
+        {
+            return buffer[element_index(i)];
+        }
+
+        /**
+         * @brief Returns reference to the element at the given position,
+         * counting from the front of the Queue.
+         *
+         * @param i Position of the element from the Queue front.
+         *
+         * @return T_QUEUE_ELEMENTS* Reference to the element.
+         *
+         * @details
+         * If the position is out of the range of stored elements, a nullptr
+         * is returned.
+         */
+        T_QUEUE_ELEMENTS* at(size_type i)
+        {
+            if ( i >= size() )
+                return nullptr;
+
+            return &(buffer[element_index(i)]);
+        }
+
+        const T_QUEUE_ELEMENTS* at(size_type i) const
+        {
+            if ( i >= size() )
+                return nullptr;
+
+            return &(buffer[element_index(i)]);
+        }
+
+        /**
+         * @brief Returns an iterator to the front element of the Queue.
+         */
+        iterator begin() { return iterator(this, 0); }
+        const_iterator begin() const { return const_iterator(this, 0); }
+        const_iterator cbegin() const { return const_iterator(this, 0); }
+
+        /**
+         * @brief Returns an iterator past the back element of the Queue.
+         */
+        iterator end() { return iterator(this, size()); }
+        const_iterator end() const { return const_iterator(this, size()); }
+        const_iterator cend() const { return const_iterator(this, size()); }
+
+        /**
+         * @brief Calls the given function for each contiguous segment of
+         * elements stored in the Queue, from the front to the back.
+         *
+         * @param f Function to call as f(T_QUEUE_ELEMENTS* data, size_type n).
+         *
+         * @details
+         * The stored elements are contiguous in the buffer unless they wrap
+         * around its end, so the function is called at most two times: one
+         * for the elements from the front to the end of the buffer and one
+         * for the elements from the start of the buffer to the back. Each
+         * segment is a plain array, so the loops over it can be vectorized
+         * by the compiler. If the Queue is empty, the function is not
+         * called.
+         */
+        template <typename T_FUNCTION>
+        void for_each_segment(T_FUNCTION f)
+        {
+            size_type first_index, first_count;
+
+            if ( empty() )
+                return;
+
+            first_index = element_index(0U);
+            first_count = capacity() - first_index;
+            if ( first_count >= size() )
+            {
+                f(&(buffer[first_index]), size());
+                return;
+            }
+
+            f(&(buffer[first_index]), first_count);
+            f(&(buffer[0]), size() - first_count);
+        }
+
+        template <typename T_FUNCTION>
+        void for_each_segment(T_FUNCTION f) const
+        {
+            size_type first_index, first_count;
+
+            if ( empty() )
+                return;
+
+            first_index = element_index(0U);
+            first_count = capacity() - first_index;
+            if ( first_count >= size() )
+            {
+                f(&(buffer[first_index]), size());
+                return;
+            }
+
+            f(&(buffer[first_index]), first_count);
+            f(&(buffer[0]), size() - first_count);
+        }
+
+        /**
+         * @brief Returns reference to the storage policy object that holds
+         * the elements buffer (i.e. to check or configure its memory).
+         *
+         * @return storage_type& Reference to the storage.
+         */
+        storage_type& storage()
+        {
+            return buffer;
+        }
+
+        const storage_type& storage() const
+        {
+            return buffer;
+        }
+
+        /**
+         * @brief Writes a snapshot of the Queue contents (a header followed
+         * by the stored elements, from the front to the back).
+         *
+         * @param writer Function to call as writer(const void* data,
+         * size_t size) for each block of bytes to write, that returns true
+         * if the block has been written.
+         *
+         * @return true if the snapshot has been written.
+         *
+         * @return false if any write has failed.
+         *
+         * @details
+         * The elements are written as raw bytes, so the element type must be
+         * trivially copyable. Each contiguous segment of the buffer is
+         * written in a single block, so there are at most three writes.
+         */
+        template <typename T_WRITER>
+        bool snapshot(T_WRITER writer) const
+        {
+            static_assert(std::is_trivially_copyable<T_QUEUE_ELEMENTS>::value,
+                    "Queue snapshot requires trivially copyable elements");
+            t_squeue_snapshot header;
+            bool result;
+
+            header.magic = SQUEUE_SNAPSHOT_MAGIC;
+            header.version = SQUEUE_SNAPSHOT_VERSION;
+            header.element_size = sizeof(T_QUEUE_ELEMENTS);
+            header.reserved = 0U;
+            header.count = size();
+            result = writer(static_cast<const void*>(&header), sizeof(header));
+
+            for_each_segment(
+                [&](const T_QUEUE_ELEMENTS* data, size_type n)
+                {
+                    if ( result )
+                        result = writer(static_cast<const void*>(data),
+                                n * sizeof(T_QUEUE_ELEMENTS));
+                });
+
+            return result;
+        }
+
+        /**
+         * @brief Replaces the Queue contents with a snapshot written by
+         * snapshot().
+         *
+         * @param reader Function to call as reader(void* data, size_t size)
+         * for each block of bytes to read, that returns true if the whole
+         * block has been read.
+         *
+         * @return true if the snapshot has been restored.
+         *
+         * @return false if any read has failed or the snapshot is not valid
+         * for this Queue (different element size or more elements than
+         * the Queue capacity). The Queue is left empty in that case.
+         *
+         * @details
+         * The elements are read in a single block to the start of the
+         * buffer, so the front element is placed at index 0.
+         */
+        template <typename T_READER>
+        bool restore(T_READER reader)
+        {
+            static_assert(std::is_trivially_copyable<T_QUEUE_ELEMENTS>::value,
+                    "Queue restore requires trivially copyable elements");
+            t_squeue_snapshot header;
+
+            clear();
+
+            if ( !reader(static_cast<void*>(&header), sizeof(header)) )
+                return false;
+
+            if ( (header.magic != SQUEUE_SNAPSHOT_MAGIC) ||
+                 (header.version != SQUEUE_SNAPSHOT_VERSION) ||
+                 (header.element_size != sizeof(T_QUEUE_ELEMENTS)) ||
+                 (header.count > capacity()) )
+                return false;
+
+            if ( header.count == 0U )
+                return true;
+
+            if ( !reader(static_cast<void*>(&(buffer[0])),
+                    header.count * sizeof(T_QUEUE_ELEMENTS)) )
+                return false;
+
+            // Front element at index 0 (next to tail) and back one at head
+            queue_tail = static_cast<index_type>(capacity() - 1U);
+            queue_head = static_cast<index_type>(t_index::advance(queue_tail,
+                    static_cast<size_type>(header.count), capacity()));
+
+            return true;
+        }
+
 #if 0 /* The next methods are not currently supported */
         /**
          * @brief Pushes a new element to the end of the Queue. The element is
@@ -246,27 +1086,33 @@ class SQueue
 
     private:
 
-        /* Private Attributes */
+        /* Private Constants */
 
         /**
-         * @brief Internal buffer to store Queue elements.
+         * @brief Number of bytes of each element that drain() prefetches.
          */
-        T_QUEUE_ELEMENTS buffer[QUEUE_SIZE];
+        static const size_t PREFETCH_BYTES =
+                ( sizeof(T_QUEUE_ELEMENTS) < SQUEUE_PREFETCH_MAX_BYTES ) ?
+                sizeof(T_QUEUE_ELEMENTS) : SQUEUE_PREFETCH_MAX_BYTES;
+
+        /* Private Attributes */
 
         /**
-         * @brief Queue circular buffer head location index.
+         * @brief Internal buffer to store Queue elements.
          */
-        uint32_t queue_head;
+        storage_type buffer;
 
         /**
-         * @brief Queue circular buffer tail location index.
+         * @brief Queue circular buffer head location index (range 0 to
+         * 2*QUEUE_SIZE-1).
          */
-        uint32_t queue_tail;
+        index_type queue_head;
 
         /**
-         * @brief Current number of elements stored in the buffer.
+         * @brief Queue circular buffer tail location index (range 0 to
+         * 2*QUEUE_SIZE-1).
          */
-        uint32_t num_elements_stored;
+        index_type queue_tail;
 
         /**
          * @brief Queue is full and has been overflowed.
@@ -283,11 +1129,59 @@ class SQueue
          * @return false otherwise.
          * @details
          * This function checks if the Queue is full by checking if current
-         * size is equal maximum static queue size (QUEUE_SIZE).
+         * size is equal the Queue capacity.
          */
         bool full()
         {
-            return ( size() >= QUEUE_SIZE );
+            return ( size() >= capacity() );
+        }
+
+        /**
+         * @brief Checks if the Queue has no elements buffer.
+         * @return true if the storage capacity is 0 (i.e. the storage
+         * allocation or mapping has failed).
+         * @return false otherwise (always for the embedded array storage).
+         * @details
+         * Any other operation is safe on a Queue without buffer, as it is
+         * always empty (the head and tail indexes are kept at 0).
+         */
+        bool no_buffer() const
+        {
+            return ( capacity() == 0U );
+        }
+
+        /**
+         * @brief Get the buffer position of an element from its position
+         * counting from the Queue front.
+         * @param i Position of the element from the Queue front.
+         * @return size_type The buffer position of the element.
+         * @details
+         * The front element is stored in the buffer position next to the
+         * tail index, so the position plus one is added to it.
+         */
+        size_type element_index(size_type i) const
+        {
+            return t_index::slot(t_index::advance(queue_tail, i + 1U,
+                    capacity()), capacity());
+        }
+
+        /**
+         * @brief Request to the cache all the lines of an element, up to
+         * PREFETCH_BYTES bytes.
+         * @param slot Buffer position of the element.
+         */
+        void prefetch(size_type slot) const
+        {
+            const char* address =
+                    reinterpret_cast<const char*>(&(buffer[slot]));
+
+            for ( size_t offset = 0U; offset < PREFETCH_BYTES;
+                  offset += SQUEUE_CACHE_LINE_SIZE )
+                SQUEUE_PREFETCH(address + offset);
+
+            // The last line, if the element does not start at a line
+            if ( PREFETCH_BYTES > 1U )
+                SQUEUE_PREFETCH(address + (PREFETCH_BYTES - 1U));
         }
 };
 
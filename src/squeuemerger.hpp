@@ -0,0 +1,427 @@
+
+/**
+ * @file    squeuemerger.hpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    17-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * A k-way merger of several Queues (i.e. one SQueue per ingested feed),
+ * whose elements are already ordered by a key (i.e. a timestamp) in each
+ * Queue, that yields the elements of all the Queues in global key order.
+ *
+ * The merger uses a tournament tree in static storage, with one leaf per
+ * Queue, where each internal node keeps the winner leaf of the match
+ * between its two children, so the root keeps the Queue of the next
+ * element. When the front element of a Queue changes, just the matches on
+ * the path from its leaf to the root are played again (log2(K) key
+ * comparisons, instead of the K comparisons of a linear scan of all the
+ * Queues fronts). Unlike a loser tree, the path of any leaf can be played
+ * again, not only the winner one, so a Queue that gets new elements takes
+ * its place in the tree without a full rebuild.
+ *
+ * The elements are not copied. The key of a Queue front element is read
+ * once, when that front changes, and it is kept in the tree nodes with the
+ * winner leaf, so a match just compares the keys of two contiguous nodes
+ * without reading the Queues. An empty Queue acts as a sentinel leaf that
+ * loses every match.
+ *
+ * The merger does not check the Queues on front() or pop(), so each op
+ * costs log2(K) matches whatever the number of empty Queues. Any change of
+ * a Queue front out of the merger must be notified with notify(): a push
+ * to an empty Queue, an external pop, or an overflow of a full SQueue (that
+ * overwrites its front element). When the feeds do not tell which empty
+ * Queues have got elements, refill() checks all the empty ones (the empty
+ * Queues are tracked in a bitmask), and rebuild() plays the whole tree
+ * again.
+ *
+ * Equal keys are yielded in Queue order (lowest Queue number first).
+ *
+ * With a few Queues (K = 4) a linear scan of the fronts is still faster
+ * (about 1.5 times), the merger pays off from K = 16 (see the
+ * bench_queuemerger benchmark).
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2022 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#ifndef STATIC_QUEUE_MERGER_H_
+#define STATIC_QUEUE_MERGER_H_
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ libraries
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+// Static Queue
+#include "squeue.hpp"
+
+/*****************************************************************************/
+
+/* Class Interface */
+
+template <typename T_QUEUE, uint32_t NUM_QUEUES, typename T_KEY>
+class SQueueMerger
+{
+    static_assert((NUM_QUEUES > 0U) && (NUM_QUEUES <= 0x80000000U),
+            "Merger must have between 1 and 2^31 Queues");
+
+    public:
+
+        /* Public Types */
+
+        typedef typename T_QUEUE::value_type value_type;
+
+        /**
+         * @brief Type of the keys returned by the key extractor (it must be
+         * default constructible and copyable).
+         */
+        typedef typename std::decay<decltype(std::declval<const T_KEY&>()(
+                std::declval<const value_type&>()))>::type key_type;
+
+        /* Public Methods */
+
+        /**
+         * @brief Construct a SQueueMerger object.
+         *
+         * @param queues Array of NUM_QUEUES Queues to merge (they must
+         * outlive the merger).
+         *
+         * @param key Key extractor function object, called as
+         * key(const value_type& element), that returns a key comparable
+         * with the operator <.
+         */
+        explicit SQueueMerger(T_QUEUE* const* queues,
+                const T_KEY& key = T_KEY()) :
+            element_key(key)
+        {
+            for ( uint32_t i = 0U; i < NUM_QUEUES; i++ )
+                sources[i] = queues[i];
+            rebuild();
+        }
+
+        /**
+         * @brief Plays all the matches of the tree again, reading all the
+         * Queues fronts (i.e. after external pops or overflows of several
+         * Queues).
+         */
+        void rebuild()
+        {
+            for ( uint32_t i = 0U; i < EMPTY_WORDS; i++ )
+                empty_leaves[i] = 0U;
+
+            for ( uint32_t i = 0U; i < NUM_LEAVES; i++ )
+                load_leaf(i);
+
+            for ( uint32_t node = NUM_LEAVES - 1U; node > 0U; node-- )
+                tree[node] = match(node);
+        }
+
+        /**
+         * @brief Plays again the matches of the empty Queues that have got
+         * new elements, when it is not known which ones.
+         *
+         * @details
+         * It checks all the Queues that were empty when their matches were
+         * played, so its cost grows with the number of empty Queues. If the
+         * Queues that get elements are known, notify() them instead.
+         */
+        void refill()
+        {
+            for ( uint32_t w = 0U; w < EMPTY_WORDS; w++ )
+            {
+                uint64_t pending = empty_leaves[w];
+
+                while ( pending != 0U )
+                {
+                    uint32_t queue = (w * 64U) + lowest_bit(pending);
+
+                    pending = pending & (pending - 1U);
+                    if ( !sources[queue]->empty() )
+                    {
+                        load_leaf(queue);
+                        replay(queue);
+                    }
+                }
+            }
+        }
+
+        /**
+         * @brief Plays again the matches of a Queue whose front element has
+         * changed out of the merger (a push to the empty Queue, an external
+         * pop or an overflow).
+         *
+         * @param queue Queue number.
+         *
+         * @return true if the Queue has been notified.
+         *
+         * @return false if the Queue number is out of range.
+         */
+        bool notify(uint32_t queue)
+        {
+            if ( queue >= NUM_QUEUES )
+                return false;
+
+            load_leaf(queue);
+            replay(queue);
+
+            return true;
+        }
+
+        /**
+         * @brief Returns the number of the Queue of the next element in key
+         * order.
+         *
+         * @return uint32_t The Queue number (NUM_QUEUES if all the Queues
+         * are empty).
+         */
+        uint32_t top_queue() const
+        {
+            if ( tree[1].empty )
+                return NUM_QUEUES;
+
+            return tree[1].leaf;
+        }
+
+        /**
+         * @brief Returns reference to the next element in key order.
+         *
+         * @return value_type* Reference to the element. If all the Queues
+         * are empty, a nullptr is returned.
+         */
+        value_type* front()
+        {
+            uint32_t winner = top_queue();
+
+            if ( winner >= NUM_QUEUES )
+                return nullptr;
+
+            return sources[winner]->front();
+        }
+
+        /**
+         * @brief Removes the next element in key order from its Queue. If
+         * all the Queues are empty, do nothing.
+         */
+        void pop()
+        {
+            uint32_t winner = top_queue();
+
+            if ( winner >= NUM_QUEUES )
+                return;
+
+            sources[winner]->pop();
+            load_leaf(winner);
+            replay(winner);
+        }
+
+    /*********************************/
+
+    private:
+
+        /* Private Data Types */
+
+        /**
+         * @brief Tree node: the winner leaf of the node matches and the key
+         * of its Queue front element.
+         */
+        struct t_node
+        {
+            key_type key;
+            uint32_t leaf;
+            bool empty;
+        };
+
+        /* Private Constants */
+
+        /**
+         * @brief Get the number of leaves of the tree, the number of Queues
+         * rounded up to a power of two.
+         * @param n Number of Queues.
+         * @param leaves Current power of two.
+         * @return uint32_t The number of leaves.
+         */
+        static constexpr uint32_t leaves(uint32_t n, uint32_t leaves = 1U)
+        {
+            return ( leaves >= n ) ? leaves : SQueueMerger::leaves(n,
+                    leaves * 2U);
+        }
+
+        /**
+         * @brief Number of leaves of the tree (the leaves after the last
+         * Queue are always empty).
+         */
+        static const uint32_t NUM_LEAVES = leaves(NUM_QUEUES);
+
+        /**
+         * @brief Number of words of the empty Queues bitmask.
+         */
+        static const uint32_t EMPTY_WORDS = (NUM_QUEUES + 63U) / 64U;
+
+        /* Private Attributes */
+
+        /**
+         * @brief Queues to merge.
+         */
+        T_QUEUE* sources[NUM_QUEUES];
+
+        /**
+         * @brief Tournament tree: the winner of each internal node at
+         * positions 1 to NUM_LEAVES-1 (the root at position 1, and the
+         * children of the node i are the nodes 2i and 2i+1), and the leaf j
+         * at position NUM_LEAVES+j.
+         */
+        t_node tree[2U * NUM_LEAVES];
+
+        /**
+         * @brief Queues that were empty when their matches were played (bit
+         * i%64 of word i/64 for the Queue i).
+         */
+        uint64_t empty_leaves[EMPTY_WORDS];
+
+        /**
+         * @brief Key extractor function object.
+         */
+        T_KEY element_key;
+
+        /******************************/
+
+        /* Private Methods */
+
+        /**
+         * @brief Read the front element key of a leaf Queue, marking the
+         * leaf as empty if it has no Queue or its Queue is empty.
+         * @param leaf Leaf number.
+         */
+        void load_leaf(uint32_t leaf)
+        {
+            t_node& node = tree[NUM_LEAVES + leaf];
+
+            node.leaf = leaf;
+            node.empty = ( (leaf >= NUM_QUEUES) || sources[leaf]->empty() );
+            if ( leaf >= NUM_QUEUES )
+                return;
+
+            if ( node.empty )
+                set_empty(leaf);
+            else
+            {
+                clear_empty(leaf);
+                node.key = element_key(*(sources[leaf]->front()));
+            }
+        }
+
+        /**
+         * @brief Mark a Queue as empty.
+         * @param queue Queue number.
+         */
+        void set_empty(uint32_t queue)
+        {
+            empty_leaves[queue / 64U] = empty_leaves[queue / 64U] |
+                    (static_cast<uint64_t>(1U) << (queue % 64U));
+        }
+
+        /**
+         * @brief Mark a Queue as not empty.
+         * @param queue Queue number.
+         */
+        void clear_empty(uint32_t queue)
+        {
+            empty_leaves[queue / 64U] = empty_leaves[queue / 64U] &
+                    ~(static_cast<uint64_t>(1U) << (queue % 64U));
+        }
+
+        /**
+         * @brief Get the position of the lowest set bit of a non zero word.
+         * @param x The word.
+         * @return uint32_t The bit position.
+         */
+        static uint32_t lowest_bit(uint64_t x)
+        {
+        #if defined(__GNUC__)
+            return static_cast<uint32_t>(__builtin_ctzll(x));
+        #else
+            uint32_t n = 0U;
+            while ( (x & 1U) == 0U )
+            {
+                x = x >> 1;
+                n = n + 1U;
+            }
+            return n;
+        #endif
+        }
+
+        /**
+         * @brief Play a match between the winners of two nodes.
+         * @param a First node.
+         * @param b Second node.
+         * @return true if the node a wins (its front element goes first).
+         */
+        static bool beats(const t_node& a, const t_node& b)
+        {
+            if ( a.empty || b.empty )
+                return ( b.empty && (!a.empty || (a.leaf < b.leaf)) );
+
+            // Bitwise operators, so the compiler does not add branches
+            return ( (a.key < b.key) |
+                     (!(b.key < a.key) & (a.leaf < b.leaf)) );
+        }
+
+        /**
+         * @brief Play the match of an internal node between the winners of
+         * its children.
+         * @param node Internal node position.
+         * @return const t_node& The winner child node.
+         */
+        const t_node& match(uint32_t node) const
+        {
+            const t_node& left = tree[2U * node];
+            const t_node& right = tree[(2U * node) + 1U];
+
+            // Winner position select instead of a branch
+            return tree[(2U * node) + (beats(left, right) ? 0U : 1U)];
+        }
+
+        /**
+         * @brief Play again the matches from a leaf to the root.
+         * @param leaf Leaf number whose front element has changed.
+         * @details
+         * All the log2(K) matches of the path are played, the merged keys
+         * order is not predictable, so an early stop just adds a branch that
+         * is often mispredicted.
+         */
+        void replay(uint32_t leaf)
+        {
+            for ( uint32_t node = (NUM_LEAVES + leaf) / 2U; node > 0U;
+                  node = node / 2U )
+                tree[node] = match(node);
+        }
+};
+
+/*****************************************************************************/
+
+#endif /* STATIC_QUEUE_MERGER_H_ */
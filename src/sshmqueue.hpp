@@ -0,0 +1,627 @@
+
+/**
+ * @file    sshmqueue.hpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    17-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * A Queue to exchange fixed size elements between processes, where the
+ * whole Queue state (indexes and elements buffer) is placed in a POSIX
+ * shared memory object or a memory mapped file.
+ *
+ * The shared memory layout is position independent (only indexes are
+ * stored, no pointers), so each process can map it at any address. It
+ * starts with a header that stores a magic number, a layout version, the
+ * Queue capacity, the element size and the concurrency mode, that is
+ * checked by any process that attaches to the Queue.
+ *
+ * Two lock-free concurrency modes are provided:
+ * - SHM_SPSC: one producer and one consumer. The head index is only
+ *   written by the producer and the tail index only by the consumer.
+ * - SHM_MPSC: multiple producers and one consumer. The producers reserve a
+ *   slot incrementing the head index with a compare and swap, and each slot
+ *   has a sequence number that tells the consumer when its element has
+ *   been written.
+ *
+ * Unlike SQueue, a push in a full Queue can not overwrite the oldest
+ * element (it could be in use by the consumer), so the new element is
+ * rejected and BUFFER_OVERFLOW is returned. The indexes are free running
+ * 32 bits counters, so the Queue size must be a power of two.
+ *
+ * The producers can use push_stream() instead of push() for large elements
+ * that they do not read again, that writes the element with non-temporal
+ * (streaming) stores on x86-64, so the element does not evict the producer
+ * cache lines. It can be disabled by defining SQUEUE_NO_SIMD before
+ * including this file.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2022 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#ifndef STATIC_SHM_QUEUE_H_
+#define STATIC_SHM_QUEUE_H_
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ libraries
+#include <atomic>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+
+// Static Queue
+#include "squeue.hpp"
+
+// Shared memory mapping
+#include "smemmap.hpp"
+
+/*****************************************************************************/
+
+/* SIMD Support */
+
+#if !defined(SQUEUE_NO_SIMD) && defined(__GNUC__) && defined(__x86_64__)
+    #define SQUEUE_STREAM_X86 1
+    #include <immintrin.h>
+#endif
+
+/*****************************************************************************/
+
+/* Data Types */
+
+typedef enum t_shm_mode
+{
+    SHM_SPSC = 0,
+    SHM_MPSC = 1,
+} t_shm_mode;
+
+/*****************************************************************************/
+
+/* Class Interface */
+
+template <typename T_QUEUE_ELEMENTS, uint32_t QUEUE_SIZE,
+        t_shm_mode SHM_MODE = SHM_SPSC>
+class SShmQueue
+{
+    static_assert(std::is_trivially_copyable<T_QUEUE_ELEMENTS>::value,
+            "Shared memory Queue elements must be trivially copyable");
+    static_assert((QUEUE_SIZE > 0U) && ((QUEUE_SIZE & (QUEUE_SIZE - 1U)) == 0U),
+            "Shared memory Queue size must be a power of two");
+    static_assert(ATOMIC_INT_LOCK_FREE == 2,
+            "Shared memory Queue requires lock-free atomics");
+
+    public:
+
+        /* Public Constants */
+
+        static const uint32_t MAGIC = 0x53514D51U; // "SQMQ"
+        static const uint32_t VERSION = 2U;
+
+        /* Public Methods */
+
+        /**
+         * @brief Construct a SShmQueue object (not attached to any shared
+         * memory).
+         */
+        SShmQueue() : header(nullptr), slots(nullptr) {}
+
+        /**
+         * @brief Create the shared memory Queue and attach to it.
+         *
+         * @param name Shared memory object name (i.e. "/my_queue") or file
+         * path, depending on the backing type.
+         *
+         * @param backing Backing type (SMEM_SHM or SMEM_FILE).
+         *
+         * @return true if the Queue has been created.
+         *
+         * @return false otherwise.
+         *
+         * @details
+         * Any previous content of the object is discarded and the Queue is
+         * initialized empty. The header magic number is written last, so
+         * other processes can not attach until the Queue is ready.
+         */
+        bool create(const char* name, t_smem_backing backing = SMEM_SHM)
+        {
+            if ( !memory.open(name, map_size(), backing, true) )
+                return false;
+            map_layout();
+
+            header->magic.store(0U, std::memory_order_relaxed);
+            header->version = VERSION;
+            header->element_size = sizeof(T_QUEUE_ELEMENTS);
+            header->capacity = QUEUE_SIZE;
+            header->mode = SHM_MODE;
+            new (&(header->head)) std::atomic<uint32_t>(0U);
+            new (&(header->tail)) std::atomic<uint32_t>(0U);
+            if ( SHM_MODE == SHM_MPSC )
+            {
+                for ( uint32_t i = 0U; i < QUEUE_SIZE; i++ )
+                    new (&(mpsc_slot(i).seq)) std::atomic<uint32_t>(i);
+            }
+            header->magic.store(MAGIC, std::memory_order_release);
+
+            return true;
+        }
+
+        /**
+         * @brief Attach to a shared memory Queue created by other process.
+         *
+         * @param name Shared memory object name or file path.
+         *
+         * @param backing Backing type (SMEM_SHM or SMEM_FILE).
+         *
+         * @return true if the Queue has been attached.
+         *
+         * @return false otherwise (the object does not exists, it is not
+         * initialized yet or its header does not match this Queue type).
+         */
+        bool attach(const char* name, t_smem_backing backing = SMEM_SHM)
+        {
+            if ( !memory.open(name, map_size(), backing, false) )
+                return false;
+            map_layout();
+
+            if ( (header->magic.load(std::memory_order_acquire) != MAGIC) ||
+                 (header->version != VERSION) ||
+                 (header->element_size != sizeof(T_QUEUE_ELEMENTS)) ||
+                 (header->capacity != QUEUE_SIZE) ||
+                 (header->mode != SHM_MODE) )
+            {
+                detach();
+                return false;
+            }
+
+            return true;
+        }
+
+        /**
+         * @brief Detach from the shared memory Queue (it is kept for other
+         * processes).
+         */
+        void detach()
+        {
+            memory.close();
+            header = nullptr;
+            slots = nullptr;
+        }
+
+        /**
+         * @brief Remove a shared memory Queue object.
+         *
+         * @param name Shared memory object name or file path.
+         *
+         * @param backing Backing type (SMEM_SHM or SMEM_FILE).
+         *
+         * @return true if the object has been removed.
+         *
+         * @return false otherwise.
+         */
+        static bool remove(const char* name, t_smem_backing backing = SMEM_SHM)
+        {
+            return SMemMap::remove(name, backing);
+        }
+
+        /**
+         * @brief Check if the Queue is attached to a shared memory.
+         *
+         * @return true if the Queue is attached.
+         *
+         * @return false otherwise.
+         */
+        bool is_attached() const
+        {
+            return ( header != nullptr );
+        }
+
+        /**
+         * @brief Check if the Queue is empty.
+         *
+         * @return true if the Queue is empty.
+         *
+         * @return false otherwise.
+         *
+         * @details
+         * The result is just a snapshot, other processes can be modifying
+         * the Queue concurrently.
+         */
+        bool empty() const
+        {
+            return ( size() == 0U );
+        }
+
+        /**
+         * @brief Returns the number of elements currently stored in the
+         * Queue (a snapshot, as it can be concurrently modified).
+         *
+         * @return uint32_t The number of elements in the Queue (0 if the
+         * Queue is not attached).
+         */
+        uint32_t size() const
+        {
+            uint32_t tail, head;
+
+            if ( header == nullptr )
+                return 0U;
+
+            tail = header->tail.load(std::memory_order_acquire);
+            head = header->head.load(std::memory_order_acquire);
+
+            return head - tail;
+        }
+
+        /**
+         * @brief Pushes the given element value to the end of the Queue.
+         * Producer side.
+         *
+         * @param element The value of the element to push.
+         *
+         * @return t_overflow BUFFER_OK if the element has been pushed, or
+         * BUFFER_OVERFLOW if the Queue is full or not attached and the
+         * element has been discarded.
+         */
+        t_overflow push(const T_QUEUE_ELEMENTS& element)
+        {
+            return push_element(element, false);
+        }
+
+        /**
+         * @brief Pushes the given element value to the end of the Queue,
+         * writing it with non-temporal stores. Producer side.
+         *
+         * @param element The value of the element to push.
+         *
+         * @return t_overflow BUFFER_OK if the element has been pushed, or
+         * BUFFER_OVERFLOW if the Queue is full or not attached and the
+         * element has been discarded.
+         *
+         * @details
+         * The streaming stores bypass the producer cache, so this is only
+         * useful for large elements (several cache lines) that the producer
+         * does not read again. They are used when the element size is a
+         * multiple of 16 bytes (the slots are then 16 bytes aligned in both
+         * modes), and a store fence is issued before the element is
+         * published to the consumer. Otherwise, it behaves as push() (see
+         * stream_enabled()).
+         */
+        t_overflow push_stream(const T_QUEUE_ELEMENTS& element)
+        {
+            return push_element(element, true);
+        }
+
+        /**
+         * @brief Check if push_stream() writes the elements with
+         * non-temporal stores.
+         *
+         * @return true if the streaming stores are used.
+         *
+         * @return false if they are not supported (architecture, element
+         * size or slot alignment) or the Queue is not attached, so
+         * push_stream() behaves as push().
+         */
+        bool stream_enabled() const
+        {
+            if ( header == nullptr )
+                return false;
+
+            if ( SHM_MODE == SHM_SPSC )
+                return streamable(slots);
+
+            return streamable(&(reinterpret_cast<const t_mpsc_slot*>(slots)
+                    ->value));
+        }
+
+        /**
+         * @brief Returns reference to the first element in the Queue.
+         * Consumer side.
+         *
+         * @return T_QUEUE_ELEMENTS* Reference to the first element.
+         *
+         * @details
+         * The element is read in place from the shared memory and it is
+         * valid until pop() is called. If there is no elements on the
+         * Queue, or it is not attached, a nullptr is returned.
+         */
+        T_QUEUE_ELEMENTS* front()
+        {
+            uint32_t tail;
+
+            if ( header == nullptr )
+                return nullptr;
+
+            tail = header->tail.load(std::memory_order_relaxed);
+
+            if ( SHM_MODE == SHM_SPSC )
+            {
+                uint32_t head = header->head.load(std::memory_order_acquire);
+
+                if ( head == tail )
+                    return nullptr;
+
+                return &(spsc_slot(tail));
+            }
+
+            if ( mpsc_slot(tail).seq.load(std::memory_order_acquire) !=
+                 (tail + 1U) )
+                return nullptr;
+
+            return &(mpsc_slot(tail).value);
+        }
+
+        /**
+         * @brief Removes an element from the front of the Queue. Consumer
+         * side. If the Queue is empty or not attached, do nothing.
+         */
+        void pop()
+        {
+            uint32_t tail;
+
+            if ( front() == nullptr )
+                return;
+
+            tail = header->tail.load(std::memory_order_relaxed);
+            if ( SHM_MODE == SHM_MPSC )
+            {
+                // Release the slot for the producers of the next lap
+                mpsc_slot(tail).seq.store(tail + QUEUE_SIZE,
+                        std::memory_order_release);
+            }
+            header->tail.store(tail + 1U, std::memory_order_release);
+        }
+
+    /*********************************/
+
+    private:
+
+        /* Private Constants */
+
+        /**
+         * @brief Alignment of the element in a slot of the multiple
+         * producers mode, 16 bytes for the elements that can be written with
+         * streaming stores (the size is a multiple of 16 bytes), so the
+         * element is not placed just after the slot sequence number.
+         */
+        static const size_t VALUE_ALIGN =
+                ( ((sizeof(T_QUEUE_ELEMENTS) % 16U) == 0U) &&
+                  (alignof(T_QUEUE_ELEMENTS) < 16U) ) ?
+                16U : alignof(T_QUEUE_ELEMENTS);
+
+        /* Private Data Types */
+
+        /**
+         * @brief Shared memory header.
+         */
+        struct t_header
+        {
+            std::atomic<uint32_t> magic;
+            uint32_t version;
+            uint32_t element_size;
+            uint32_t capacity;
+            uint32_t mode;
+            alignas(64) std::atomic<uint32_t> head;
+            alignas(64) std::atomic<uint32_t> tail;
+        };
+
+        /**
+         * @brief Element slot of the multiple producers mode.
+         */
+        struct t_mpsc_slot
+        {
+            std::atomic<uint32_t> seq;
+            alignas(VALUE_ALIGN) T_QUEUE_ELEMENTS value;
+        };
+
+        /* Private Attributes */
+
+        /**
+         * @brief Shared memory mapping.
+         */
+        SMemMap memory;
+
+        /**
+         * @brief Shared memory header address.
+         */
+        t_header* header;
+
+        /**
+         * @brief Shared memory element slots address.
+         */
+        uint8_t* slots;
+
+        /******************************/
+
+        /* Private Methods */
+
+        /**
+         * @brief Get the offset of the element slots in the shared memory,
+         * the header size rounded up to a cache line.
+         * @return size_t Slots offset.
+         */
+        static size_t slots_offset()
+        {
+            return (sizeof(t_header) + 63U) & ~static_cast<size_t>(63U);
+        }
+
+        /**
+         * @brief Get the size of an element slot.
+         * @return size_t Slot size.
+         */
+        static size_t slot_size()
+        {
+            return ( SHM_MODE == SHM_SPSC ) ? sizeof(T_QUEUE_ELEMENTS) :
+                    sizeof(t_mpsc_slot);
+        }
+
+        /**
+         * @brief Get the total shared memory size.
+         * @return size_t Shared memory size.
+         */
+        static size_t map_size()
+        {
+            return slots_offset() + (slot_size() * QUEUE_SIZE);
+        }
+
+        /**
+         * @brief Set the header and slots addresses from the mapping.
+         */
+        void map_layout()
+        {
+            header = reinterpret_cast<t_header*>(memory.data());
+            slots = memory.data() + slots_offset();
+        }
+
+        /**
+         * @brief Get the slot of an index in the single producer mode.
+         * @param index Free running index.
+         * @return T_QUEUE_ELEMENTS& Element slot.
+         */
+        T_QUEUE_ELEMENTS& spsc_slot(uint32_t index)
+        {
+            return reinterpret_cast<T_QUEUE_ELEMENTS*>(slots)
+                    [index & (QUEUE_SIZE - 1U)];
+        }
+
+        /**
+         * @brief Get the slot of an index in the multiple producers mode.
+         * @param index Free running index.
+         * @return t_mpsc_slot& Element slot.
+         */
+        t_mpsc_slot& mpsc_slot(uint32_t index)
+        {
+            return reinterpret_cast<t_mpsc_slot*>(slots)
+                    [index & (QUEUE_SIZE - 1U)];
+        }
+
+        /**
+         * @brief Push an element value to the end of the Queue.
+         * @param element The value of the element to push.
+         * @param stream Write the element with non-temporal stores.
+         * @return t_overflow BUFFER_OK if the element has been pushed, or
+         * BUFFER_OVERFLOW if the Queue is full or not attached.
+         */
+        t_overflow push_element(const T_QUEUE_ELEMENTS& element, bool stream)
+        {
+            if ( header == nullptr )
+                return BUFFER_OVERFLOW;
+
+            if ( SHM_MODE == SHM_SPSC )
+            {
+                uint32_t head = header->head.load(std::memory_order_relaxed);
+                uint32_t tail = header->tail.load(std::memory_order_acquire);
+
+                if ( (head - tail) >= QUEUE_SIZE )
+                    return BUFFER_OVERFLOW;
+
+                store(&(spsc_slot(head)), element, stream);
+                header->head.store(head + 1U, std::memory_order_release);
+
+                return BUFFER_OK;
+            }
+
+            uint32_t head = header->head.load(std::memory_order_relaxed);
+            while ( true )
+            {
+                uint32_t seq = mpsc_slot(head).seq.load(
+                        std::memory_order_acquire);
+                int32_t diff = static_cast<int32_t>(seq - head);
+
+                if ( diff == 0 )
+                {
+                    // Slot is free, try to reserve it
+                    if ( header->head.compare_exchange_weak(head, head + 1U,
+                            std::memory_order_relaxed) )
+                        break;
+                }
+                else if ( diff < 0 )
+                    return BUFFER_OVERFLOW;
+                else
+                    head = header->head.load(std::memory_order_relaxed);
+            }
+
+            store(&(mpsc_slot(head).value), element, stream);
+            mpsc_slot(head).seq.store(head + 1U, std::memory_order_release);
+
+            return BUFFER_OK;
+        }
+
+        /**
+         * @brief Check if an element slot can be written with streaming
+         * stores.
+         * @param slot Element slot address.
+         * @return true if the streaming stores are supported, the element
+         * size is a multiple of 16 bytes and the slot is 16 bytes aligned.
+         */
+        static bool streamable(const void* slot)
+        {
+        #if defined(SQUEUE_STREAM_X86)
+            return ( ((sizeof(T_QUEUE_ELEMENTS) % 16U) == 0U) &&
+                     ((reinterpret_cast<uintptr_t>(slot) % 16U) == 0U) );
+        #else
+            (void)slot;
+            return false;
+        #endif
+        }
+
+        /**
+         * @brief Write an element value into its slot.
+         * @param slot Element slot address.
+         * @param element The value of the element.
+         * @param stream Write the element with non-temporal stores when the
+         * slot alignment and element size allow it.
+         */
+        static void store(T_QUEUE_ELEMENTS* slot,
+                const T_QUEUE_ELEMENTS& element, bool stream)
+        {
+        #if defined(SQUEUE_STREAM_X86)
+            if ( stream && streamable(slot) )
+            {
+                const uint8_t* src = reinterpret_cast<const uint8_t*>(
+                        &element);
+                __m128i* dst = reinterpret_cast<__m128i*>(slot);
+
+                for ( size_t i = 0U; i < (sizeof(T_QUEUE_ELEMENTS) / 16U);
+                      i++ )
+                {
+                    _mm_stream_si128(&(dst[i]), _mm_loadu_si128(
+                            reinterpret_cast<const __m128i*>(src + (i * 16U))));
+                }
+
+                // Streaming stores are weakly ordered, complete them before
+                // the release store that publishes the element
+                _mm_sfence();
+                return;
+            }
+        #else
+            (void)stream;
+        #endif
+
+            *slot = element;
+        }
+};
+
+/*****************************************************************************/
+
+#endif /* STATIC_SHM_QUEUE_H_ */
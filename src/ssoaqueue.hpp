@@ -0,0 +1,337 @@
+
+/**
+ * @file    ssoaqueue.hpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    17-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * A static memory allocated Queue of multiple fields records that stores
+ * each field in its own array (structure of arrays layout), so a consumer
+ * that reads just one or two fields of the records does not need to load
+ * the other fields into the cache.
+ *
+ * All the field arrays share the same head and tail indexes, that behave
+ * exactly like the SQueue ones (a push in a full Queue overwrites the
+ * oldest record). Each field column can be accessed by position or
+ * traversed in at most two contiguous segments, to allow vectorized loops
+ * over a single field.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2022 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#ifndef STATIC_SOA_QUEUE_H_
+#define STATIC_SOA_QUEUE_H_
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ libraries
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+
+// Static Queue
+#include "squeue.hpp"
+
+/*****************************************************************************/
+
+/* Class Interface */
+
+template <uint64_t QUEUE_SIZE, typename... T_FIELDS>
+class SoaSQueue
+{
+    static_assert(QUEUE_SIZE > 0U, "Queue size must be greater than 0");
+    static_assert(sizeof...(T_FIELDS) > 0U, "Queue needs at least one field");
+
+    public:
+
+        /* Public Types */
+
+        typedef SQueueIndex<QUEUE_SIZE> t_index;
+        typedef typename t_index::size_type size_type;
+        typedef typename t_index::index_type index_type;
+
+        /**
+         * @brief Type of the field I of the records.
+         */
+        template <size_t I>
+        using field_type =
+            typename std::tuple_element<I, std::tuple<T_FIELDS...>>::type;
+
+        /* Public Methods */
+
+        /**
+         * @brief Construct a SoaSQueue object.
+         */
+        SoaSQueue()
+        {
+            clear();
+        }
+
+        /**
+         * @brief Clear the Queue.
+         */
+        void clear()
+        {
+            queue_head = 0U;
+            queue_tail = 0U;
+            buffer_overflow = false;
+        }
+
+        /**
+         * @brief Check if the Queue is empty (no records in the buffer).
+         *
+         * @return true if the Queue is empty.
+         *
+         * @return false otherwise.
+         */
+        bool empty() const
+        {
+            return ( queue_head == queue_tail );
+        }
+
+        /**
+         * @brief Returns the number of records currently stored in the Queue.
+         *
+         * @return size_type The number of records in the Queue.
+         */
+        size_type size() const
+        {
+            return t_index::distance(queue_tail, queue_head);
+        }
+
+        /**
+         * @brief Pushes a record (all its fields) to the end of the Queue.
+         *
+         * @param fields The values of the record fields.
+         *
+         * @return t_overflow BUFFER_OVERFLOW if the oldest record has been
+         * overwritten, BUFFER_OK otherwise.
+         */
+        t_overflow push(const T_FIELDS&... fields)
+        {
+            if ( size() >= QUEUE_SIZE )
+            {
+                buffer_overflow = true;
+                queue_tail = static_cast<index_type>(
+                        t_index::advance(queue_tail, 1U));
+            }
+
+            queue_head = static_cast<index_type>(
+                    t_index::advance(queue_head, 1U));
+            store_fields<0>(t_index::slot(queue_head), fields...);
+
+            if ( buffer_overflow )
+                return BUFFER_OVERFLOW;
+            else
+                return BUFFER_OK;
+        }
+
+        /**
+         * @brief Removes a record from the front of the Queue. If the Queue
+         * is empty, do nothing.
+         * Note: Any record pop will clear the queue overflow flag.
+         */
+        void pop()
+        {
+            if ( empty() )
+                return;
+
+            queue_tail = static_cast<index_type>(
+                    t_index::advance(queue_tail, 1U));
+            buffer_overflow = false;
+        }
+
+        /**
+         * @brief Returns reference to the field I of the first record.
+         *
+         * @return field_type<I>* Reference to the field. If there is no
+         * records on the Queue, a nullptr is returned.
+         */
+        template <size_t I>
+        field_type<I>* front()
+        {
+            if ( empty() )
+                return nullptr;
+
+            return &(std::get<I>(columns)[record_index(0U)]);
+        }
+
+        /**
+         * @brief Returns reference to the field I of the last record.
+         *
+         * @return field_type<I>* Reference to the field. If there is no
+         * records on the Queue, a nullptr is returned.
+         */
+        template <size_t I>
+        field_type<I>* back()
+        {
+            if ( empty() )
+                return nullptr;
+
+            return &(std::get<I>(columns)[t_index::slot(queue_head)]);
+        }
+
+        /**
+         * @brief Returns reference to the field I of the record at the given
+         * position, counting from the front of the Queue.
+         *
+         * @param i Position of the record from the Queue front.
+         *
+         * @return field_type<I>* Reference to the field. If the position is
+         * out of the range of stored records, a nullptr is returned.
+         */
+        template <size_t I>
+        field_type<I>* at(size_type i)
+        {
+            if ( i >= size() )
+                return nullptr;
+
+            return &(std::get<I>(columns)[record_index(i)]);
+        }
+
+        template <size_t I>
+        const field_type<I>* at(size_type i) const
+        {
+            if ( i >= size() )
+                return nullptr;
+
+            return &(std::get<I>(columns)[record_index(i)]);
+        }
+
+        /**
+         * @brief Calls the given function for each contiguous segment of the
+         * field I column, from the front record to the back one.
+         *
+         * @param f Function to call as f(field_type<I>* data, size_type n).
+         *
+         * @details
+         * As in SQueue::for_each_segment(), the function is called at most
+         * two times, and each segment is a plain array of the field values.
+         */
+        template <size_t I, typename T_FUNCTION>
+        void for_each_segment(T_FUNCTION f)
+        {
+            segments(std::get<I>(columns).data(), f);
+        }
+
+        template <size_t I, typename T_FUNCTION>
+        void for_each_segment(T_FUNCTION f) const
+        {
+            segments(std::get<I>(columns).data(), f);
+        }
+
+    /*********************************/
+
+    private:
+
+        /* Private Attributes */
+
+        /**
+         * @brief Internal buffers to store each field of the records.
+         */
+        std::tuple<std::array<T_FIELDS, QUEUE_SIZE>...> columns;
+
+        /**
+         * @brief Queue circular buffer head location index.
+         */
+        index_type queue_head;
+
+        /**
+         * @brief Queue circular buffer tail location index.
+         */
+        index_type queue_tail;
+
+        /**
+         * @brief Queue is full and has been overflowed.
+         */
+        bool buffer_overflow;
+
+        /******************************/
+
+        /* Private Methods */
+
+        /**
+         * @brief Get the buffer position of a record from its position
+         * counting from the Queue front.
+         * @param i Position of the record from the Queue front.
+         * @return size_type The buffer position of the record.
+         */
+        size_type record_index(size_type i) const
+        {
+            return t_index::slot(t_index::advance(queue_tail, i + 1U));
+        }
+
+        /**
+         * @brief Store the record fields, from the field I onwards, in
+         * their columns.
+         * @param slot Buffer position of the record.
+         * @param first Value of the field I.
+         * @param rest Values of the next fields.
+         */
+        template <size_t I, typename T_FIRST, typename... T_REST>
+        void store_fields(size_type slot, const T_FIRST& first,
+                const T_REST&... rest)
+        {
+            std::get<I>(columns)[slot] = first;
+            store_fields<I + 1U>(slot, rest...);
+        }
+
+        template <size_t I>
+        void store_fields(size_type)
+        {
+        }
+
+        /**
+         * @brief Call a function for each contiguous segment of a column.
+         * @param column Column buffer address.
+         * @param f Function to call as f(data, n).
+         */
+        template <typename T_COLUMN, typename T_FUNCTION>
+        void segments(T_COLUMN* column, T_FUNCTION f) const
+        {
+            size_type first_index, first_count;
+
+            if ( empty() )
+                return;
+
+            first_index = record_index(0U);
+            first_count = QUEUE_SIZE - first_index;
+            if ( first_count >= size() )
+            {
+                f(column + first_index, size());
+                return;
+            }
+
+            f(column + first_index, first_count);
+            f(column, size() - first_count);
+        }
+};
+
+/*****************************************************************************/
+
+#endif /* STATIC_SOA_QUEUE_H_ */
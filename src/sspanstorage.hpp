@@ -0,0 +1,212 @@
+
+/**
+ * @file    sspanstorage.hpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    17-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * A SQueue storage policy for runtime size Queues that uses a caller
+ * provided buffer of elements (a pointer and a number of elements, or a
+ * std::span with C++20), so a large Queue does not need to live inside
+ * the Queue object (i.e. on the stack) and its buffer can be placed in any
+ * preallocated memory.
+ *
+ * The storage does not own the buffer, it just refers to it, so the buffer
+ * must outlive the Queue. The Queue capacity is the number of elements of
+ * the buffer, that must be a power of two (otherwise the storage is not
+ * valid and the Queue has capacity 0):
+ *
+ *     static t_msg messages[1024];
+ *     SQueue<t_msg, SQUEUE_DYNAMIC_SIZE, SQueueSpanStorage> queue(
+ *             SQueueSpanStorage<t_msg, SQUEUE_DYNAMIC_SIZE>(messages, 1024));
+ *
+ * Two Queues must not share a buffer, so the storage (and a Queue that
+ * uses it) can be moved but not copied. A moved from storage has no buffer.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2022 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#ifndef STATIC_SPAN_STORAGE_H_
+#define STATIC_SPAN_STORAGE_H_
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ libraries
+#include <cstddef>
+#include <cstdint>
+
+#if (__cplusplus >= 202002L) && defined(__has_include)
+    #if __has_include(<span>)
+        #include <span>
+        #define SQUEUE_HAS_STD_SPAN 1
+    #endif
+#endif
+
+// Static Queue
+#include "squeue.hpp"
+
+/*****************************************************************************/
+
+/* Class Interface */
+
+template <typename T_ELEMENTS, uint64_t STORAGE_SIZE>
+class SQueueSpanStorage
+{
+    static_assert(STORAGE_SIZE == SQUEUE_DYNAMIC_SIZE,
+            "Span storage is only for runtime size Queues");
+
+    public:
+
+        /* Public Methods */
+
+        /**
+         * @brief Construct a SQueueSpanStorage object without buffer (not
+         * valid until a storage with a buffer is assigned to it).
+         */
+        SQueueSpanStorage()
+        {
+            elements = nullptr;
+            elements_count = 0U;
+        }
+
+        /**
+         * @brief Construct a SQueueSpanStorage object that refers to the
+         * given buffer.
+         *
+         * @param data Address of the first element of the buffer.
+         *
+         * @param size Number of elements of the buffer (a power of two).
+         */
+        SQueueSpanStorage(T_ELEMENTS* data, size_t size)
+        {
+            size_t count =
+                    SQueueIndex<SQUEUE_DYNAMIC_SIZE>::floor_capacity(size);
+
+            // A rounded down capacity would silently leave elements unused
+            elements = ( count == size ) ? data : nullptr;
+            elements_count = ( elements != nullptr ) ? count : 0U;
+        }
+
+    #if defined(SQUEUE_HAS_STD_SPAN)
+        /**
+         * @brief Construct a SQueueSpanStorage object that refers to the
+         * buffer of the given span.
+         *
+         * @param data Span of the buffer elements.
+         */
+        explicit SQueueSpanStorage(std::span<T_ELEMENTS> data) :
+            SQueueSpanStorage(data.data(), data.size())
+        {}
+    #endif
+
+        /**
+         * @brief Construct a SQueueSpanStorage object taking the buffer of
+         * another one.
+         *
+         * @param other Storage to take the buffer from (it is left without
+         * buffer).
+         */
+        SQueueSpanStorage(SQueueSpanStorage&& other)
+        {
+            elements = other.elements;
+            elements_count = other.elements_count;
+            other.elements = nullptr;
+            other.elements_count = 0U;
+        }
+
+        /**
+         * @brief Take the buffer of another storage.
+         *
+         * @param other Storage to take the buffer from (it is left without
+         * buffer).
+         *
+         * @return SQueueSpanStorage& Reference to this storage.
+         */
+        SQueueSpanStorage& operator=(SQueueSpanStorage&& other)
+        {
+            if ( this != &other )
+            {
+                elements = other.elements;
+                elements_count = other.elements_count;
+                other.elements = nullptr;
+                other.elements_count = 0U;
+            }
+
+            return *this;
+        }
+
+        SQueueSpanStorage(const SQueueSpanStorage&) = delete;
+        SQueueSpanStorage& operator=(const SQueueSpanStorage&) = delete;
+
+        /**
+         * @brief Check if the storage refers to a buffer with at least one
+         * element.
+         *
+         * @return true if the buffer can be used.
+         *
+         * @return false if there is no buffer or its size is not a power of
+         * two (the Queue has capacity 0, it is always empty and rejects
+         * every push).
+         */
+        bool valid() const
+        {
+            return ( elements_count != 0U );
+        }
+
+        /**
+         * @brief Returns reference to the element at the given buffer
+         * position.
+         */
+        T_ELEMENTS& operator[](size_t i) { return elements[i]; }
+        const T_ELEMENTS& operator[](size_t i) const { return elements[i]; }
+
+        /**
+         * @brief Returns the number of elements of the buffer (a power of
+         * two).
+         */
+        size_t capacity() const { return elements_count; }
+
+    /*********************************/
+
+    private:
+
+        /* Private Attributes */
+
+        /**
+         * @brief Buffer first element address.
+         */
+        T_ELEMENTS* elements;
+
+        /**
+         * @brief Number of elements of the buffer.
+         */
+        size_t elements_count;
+};
+
+/*****************************************************************************/
+
+#endif /* STATIC_SPAN_STORAGE_H_ */
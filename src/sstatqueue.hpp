@@ -0,0 +1,527 @@
+
+/**
+ * @file    sstatqueue.hpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    17-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * A SQueue that keeps running statistics (count, mean, variance and
+ * standard deviation) of the elements currently stored in the Queue, so
+ * they can be queried in constant time instead of rescanning the buffer.
+ *
+ * The statistics are updated incrementally on each push (adding the new
+ * element and removing the overwritten one when the Queue is full) and on
+ * each pop (removing the front element). To keep the result accurate over
+ * long streams, the sums are computed over the values shifted by a
+ * reference value (the first element pushed to the empty Queue) and
+ * accumulated using Neumaier compensated summation. Note that compiler
+ * options like -ffast-math may remove the summation compensation.
+ *
+ * The SQueue is kept as a private member and only const access to its
+ * elements is given (element access, iterators and segments), so it can
+ * only be modified through the SStatQueue methods, that keep the statistics
+ * in sync. The Queue size and storage policy template parameters are the
+ * SQueue ones.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2022 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#ifndef STATIC_STAT_QUEUE_H_
+#define STATIC_STAT_QUEUE_H_
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ libraries
+#include <cmath>
+#include <cstdint>
+#include <utility>
+
+// Static Queue
+#include "squeue.hpp"
+
+/*****************************************************************************/
+
+/* Class Interface */
+
+template <typename T_QUEUE_ELEMENTS, uint64_t QUEUE_SIZE,
+        template <typename, uint64_t> class T_STORAGE = SQueueArrayStorage>
+class SStatQueue
+{
+    public:
+
+        /* Public Types */
+
+        typedef SQueue<T_QUEUE_ELEMENTS, QUEUE_SIZE, T_STORAGE> t_queue;
+        typedef typename t_queue::value_type value_type;
+        typedef typename t_queue::storage_type storage_type;
+        typedef typename t_queue::size_type size_type;
+        typedef typename t_queue::const_iterator const_iterator;
+
+        /* Public Methods */
+
+        /**
+         * @brief Construct a SStatQueue object.
+         */
+        SStatQueue()
+        {
+            reset_stats();
+        }
+
+        /**
+         * @brief Construct a SStatQueue object that uses the given storage.
+         *
+         * @param storage Storage of the Queue elements buffer.
+         */
+        explicit SStatQueue(const storage_type& storage) : queue(storage)
+        {
+            reset_stats();
+        }
+
+        /**
+         * @brief Construct a SStatQueue object that takes the given storage.
+         *
+         * @param storage Storage of the Queue elements buffer.
+         */
+        explicit SStatQueue(storage_type&& storage) :
+            queue(std::move(storage))
+        {
+            reset_stats();
+        }
+
+        /**
+         * @brief Clear the Queue and its statistics.
+         */
+        void clear()
+        {
+            queue.clear();
+            reset_stats();
+        }
+
+        /**
+         * @brief Check if the Queue is empty.
+         *
+         * @return true if the Queue is empty.
+         *
+         * @return false otherwise.
+         */
+        bool empty() const
+        {
+            return queue.empty();
+        }
+
+        /**
+         * @brief Returns the number of elements currently stored in the Queue.
+         *
+         * @return size_type The number of elements in the Queue.
+         */
+        size_type size() const
+        {
+            return queue.size();
+        }
+
+        /**
+         * @brief Returns the maximum number of elements that can be stored
+         * in the Queue.
+         *
+         * @return size_type The Queue capacity.
+         */
+        size_type capacity() const
+        {
+            return queue.capacity();
+        }
+
+        /**
+         * @brief Returns reference to the first element in the Queue.
+         *
+         * @return const T_QUEUE_ELEMENTS* Reference to the first element. If
+         * there is no elements on the Queue, a nullptr is returned.
+         */
+        const T_QUEUE_ELEMENTS* front() const
+        {
+            return queue.at(0U);
+        }
+
+        /**
+         * @brief Returns reference to the last element in the Queue.
+         *
+         * @return const T_QUEUE_ELEMENTS* Reference to the last element. If
+         * there is no elements on the Queue, a nullptr is returned.
+         */
+        const T_QUEUE_ELEMENTS* back() const
+        {
+            if ( queue.empty() )
+                return nullptr;
+
+            return queue.at(queue.size() - 1U);
+        }
+
+        /**
+         * @brief Returns reference to the element at the given position,
+         * counting from the front of the Queue (unchecked).
+         *
+         * @param i Position of the element from the Queue front.
+         *
+         * @return const T_QUEUE_ELEMENTS& Reference to the element.
+         */
+        const T_QUEUE_ELEMENTS& operator[](size_type i) const
+        {
+            return queue[i];
+        }
+
+        /**
+         * @brief Returns reference to the element at the given position,
+         * counting from the front of the Queue.
+         *
+         * @param i Position of the element from the Queue front.
+         *
+         * @return const T_QUEUE_ELEMENTS* Reference to the element. If the
+         * position is out of range, a nullptr is returned.
+         */
+        const T_QUEUE_ELEMENTS* at(size_type i) const
+        {
+            return queue.at(i);
+        }
+
+        /**
+         * @brief Returns an iterator to the front element of the Queue.
+         */
+        const_iterator begin() const { return queue.begin(); }
+        const_iterator cbegin() const { return queue.cbegin(); }
+
+        /**
+         * @brief Returns an iterator past the back element of the Queue.
+         */
+        const_iterator end() const { return queue.end(); }
+        const_iterator cend() const { return queue.cend(); }
+
+        /**
+         * @brief Calls the given function for each contiguous segment of
+         * elements stored in the Queue, from the front to the back.
+         *
+         * @param f Function to call as f(const T_QUEUE_ELEMENTS* data,
+         * size_type n).
+         */
+        template <typename T_FUNCTION>
+        void for_each_segment(T_FUNCTION f) const
+        {
+            queue.for_each_segment(f);
+        }
+
+        /**
+         * @brief Pushes the given element value to the end of the Queue and
+         * updates the statistics.
+         *
+         * @param element The value of the element to push.
+         *
+         * @return t_overflow If the oldest element has been overwritten.
+         *
+         * @details
+         * In case of Queue is full, the front element that is going to be
+         * overwritten is removed from the statistics before adding the new
+         * one.
+         */
+        t_overflow push(T_QUEUE_ELEMENTS element)
+        {
+            if ( queue.empty() )
+            {
+                reset_stats();
+                shift = static_cast<double>(element);
+            }
+            else if ( queue.size() >= queue.capacity() )
+                remove_value(static_cast<double>(*(queue.front())));
+
+            add_value(static_cast<double>(element));
+
+            return queue.push(element);
+        }
+
+        /**
+         * @brief Removes an element from the front of the Queue and updates
+         * the statistics. If the Queue is empty, do nothing.
+         */
+        void pop()
+        {
+            if ( queue.empty() )
+                return;
+
+            remove_value(static_cast<double>(*(queue.front())));
+            queue.pop();
+
+            // Drop any accumulated rounding error when the Queue gets empty
+            if ( queue.empty() )
+                reset_stats();
+        }
+
+        /**
+         * @brief Calls the given function for each element from the front of
+         * the Queue and removes them, updating the statistics (see
+         * SQueue::drain()).
+         *
+         * @param f Function to call as f(T_QUEUE_ELEMENTS& element).
+         *
+         * @param max Maximum number of elements to remove.
+         *
+         * @param prefetch_distance Number of elements ahead of the current
+         * one to prefetch (0 to disable the prefetch).
+         *
+         * @return size_type The number of elements removed.
+         */
+        template <typename T_FUNCTION>
+        size_type drain(T_FUNCTION f, size_type max = ~size_type(0U),
+                size_type prefetch_distance = SQUEUE_PREFETCH_DISTANCE)
+        {
+            size_type n = queue.drain(
+                [&](T_QUEUE_ELEMENTS& element)
+                {
+                    remove_value(static_cast<double>(element));
+                    f(element);
+                },
+                max, prefetch_distance);
+
+            if ( queue.empty() )
+                reset_stats();
+
+            return n;
+        }
+
+        /**
+         * @brief Writes a snapshot of the Queue contents (see
+         * SQueue::snapshot()).
+         *
+         * @param writer Function to call as writer(const void* data,
+         * size_t size) for each block of bytes to write.
+         *
+         * @return true if the snapshot has been written.
+         */
+        template <typename T_WRITER>
+        bool snapshot(T_WRITER writer) const
+        {
+            return queue.snapshot(writer);
+        }
+
+        /**
+         * @brief Replaces the Queue contents with a snapshot written by
+         * snapshot() and recomputes the statistics from them (see
+         * SQueue::restore()).
+         *
+         * @param reader Function to call as reader(void* data, size_t size)
+         * for each block of bytes to read.
+         *
+         * @return true if the snapshot has been restored.
+         *
+         * @return false otherwise, the Queue is left empty.
+         */
+        template <typename T_READER>
+        bool restore(T_READER reader)
+        {
+            bool result = queue.restore(reader);
+
+            resync();
+
+            return result;
+        }
+
+        /**
+         * @brief Returns the arithmetic mean of the elements stored in the
+         * Queue.
+         *
+         * @return double The mean value. If the Queue is empty, 0 is
+         * returned.
+         */
+        double mean() const
+        {
+            if ( queue.empty() )
+                return 0.0;
+
+            return shift + (sum() / queue.size());
+        }
+
+        /**
+         * @brief Returns the population variance of the elements stored in
+         * the Queue.
+         *
+         * @return double The variance. If the Queue is empty, 0 is returned.
+         */
+        double variance() const
+        {
+            double n, s, variance;
+
+            if ( queue.empty() )
+                return 0.0;
+
+            n = static_cast<double>(queue.size());
+            s = sum();
+            variance = (sum_squares() - ((s * s) / n)) / n;
+
+            // Rounding can lead to tiny negative values for constant data
+            if ( variance < 0.0 )
+                variance = 0.0;
+
+            return variance;
+        }
+
+        /**
+         * @brief Returns the population standard deviation of the elements
+         * stored in the Queue.
+         *
+         * @return double The standard deviation. If the Queue is empty, 0 is
+         * returned.
+         */
+        double stddev() const
+        {
+            return std::sqrt(variance());
+        }
+
+        /**
+         * @brief Recompute the statistics from the stored elements.
+         *
+         * @details
+         * The incremental updates are compensated, but a long running Queue
+         * with values of very different magnitudes can still drift. This
+         * function rescans the buffer (O(N)) taking the current front
+         * element as the new reference value.
+         */
+        void resync()
+        {
+            reset_stats();
+            if ( queue.empty() )
+                return;
+
+            shift = static_cast<double>(*(queue.front()));
+            queue.for_each_segment(
+                [&](const T_QUEUE_ELEMENTS* data, size_type n)
+                {
+                    for ( size_type i = 0U; i < n; i++ )
+                        add_value(static_cast<double>(data[i]));
+                });
+        }
+
+    /*********************************/
+
+    private:
+
+        /* Private Attributes */
+
+        /**
+         * @brief The Queue of elements.
+         */
+        t_queue queue;
+
+        /**
+         * @brief Reference value subtracted from each element.
+         */
+        double shift;
+
+        /**
+         * @brief Running sum of the shifted elements and its compensation.
+         */
+        double sum_value, sum_comp;
+
+        /**
+         * @brief Running sum of the squared shifted elements and its
+         * compensation.
+         */
+        double sum_sq_value, sum_sq_comp;
+
+        /******************************/
+
+        /* Private Methods */
+
+        /**
+         * @brief Neumaier compensated addition of a value to a sum.
+         * @param total The running sum.
+         * @param comp The running compensation of the lost low order bits.
+         * @param value The value to add.
+         */
+        static void compensated_add(double& total, double& comp, double value)
+        {
+            double t = total + value;
+
+            if ( std::fabs(total) >= std::fabs(value) )
+                comp = comp + ((total - t) + value);
+            else
+                comp = comp + ((value - t) + total);
+
+            total = t;
+        }
+
+        /**
+         * @brief Add an element value to the running sums.
+         * @param value The element value.
+         */
+        void add_value(double value)
+        {
+            double d = value - shift;
+            compensated_add(sum_value, sum_comp, d);
+            compensated_add(sum_sq_value, sum_sq_comp, d * d);
+        }
+
+        /**
+         * @brief Remove an element value from the running sums.
+         * @param value The element value.
+         */
+        void remove_value(double value)
+        {
+            double d = value - shift;
+            compensated_add(sum_value, sum_comp, -d);
+            compensated_add(sum_sq_value, sum_sq_comp, -(d * d));
+        }
+
+        /**
+         * @brief Reset the running sums and the reference value.
+         */
+        void reset_stats()
+        {
+            shift = 0.0;
+            sum_value = 0.0;
+            sum_comp = 0.0;
+            sum_sq_value = 0.0;
+            sum_sq_comp = 0.0;
+        }
+
+        /**
+         * @brief Get the compensated sum of the shifted elements.
+         * @return double The sum.
+         */
+        double sum() const
+        {
+            return sum_value + sum_comp;
+        }
+
+        /**
+         * @brief Get the compensated sum of the squared shifted elements.
+         * @return double The sum of squares.
+         */
+        double sum_squares() const
+        {
+            return sum_sq_value + sum_sq_comp;
+        }
+};
+
+/*****************************************************************************/
+
+#endif /* STATIC_STAT_QUEUE_H_ */
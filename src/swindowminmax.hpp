@@ -0,0 +1,296 @@
+
+/**
+ * @file    swindowminmax.hpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    17-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * A static memory allocated sliding window minimum and maximum tracker, to
+ * be used as a companion of a SQueue with the same size, that gives the
+ * minimum and maximum of the last WINDOW_SIZE pushed values in constant
+ * time.
+ *
+ * The implementation is based on two monotonic deques stored in circular
+ * buffers of WINDOW_SIZE entries: one keeps increasing values (candidates
+ * to be the window minimum) and the other decreasing values (candidates to
+ * be the window maximum). Each entry stores the value and its push
+ * sequence number, so the front entry can be discarded when the element it
+ * refers to leaves the window. Each value is appended and discarded at
+ * most once in each deque, so the push and pop operations are O(1)
+ * amortized.
+ *
+ * The tracker follows the same push() and pop() semantics than SQueue (a
+ * push in a full window removes the oldest value), so calling both with the
+ * same values keeps them in sync.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2022 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#ifndef STATIC_WINDOW_MIN_MAX_H_
+#define STATIC_WINDOW_MIN_MAX_H_
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ libraries
+#include <cstdint>
+
+/*****************************************************************************/
+
+/* Class Interface */
+
+template <typename T_ELEMENTS, uint32_t WINDOW_SIZE>
+class SWindowMinMax
+{
+    public:
+
+        /* Public Methods */
+
+        /**
+         * @brief Construct a SWindowMinMax object.
+         */
+        SWindowMinMax()
+        {
+            clear();
+        }
+
+        /**
+         * @brief Clear the window.
+         */
+        void clear()
+        {
+            min_deque.clear();
+            max_deque.clear();
+            oldest_seq = 0U;
+            next_seq = 0U;
+        }
+
+        /**
+         * @brief Check if the window is empty.
+         *
+         * @return true if the window is empty.
+         *
+         * @return false otherwise.
+         */
+        bool empty() const
+        {
+            return ( next_seq == oldest_seq );
+        }
+
+        /**
+         * @brief Returns the number of values currently in the window.
+         *
+         * @return uint32_t The number of values in the window.
+         */
+        uint32_t size() const
+        {
+            return next_seq - oldest_seq;
+        }
+
+        /**
+         * @brief Appends a value to the window, removing the oldest one if
+         * the window is full.
+         *
+         * @param value The value to append.
+         *
+         * @details
+         * Any entry at the back of the minimum deque that is not lower than
+         * the new value can never be the window minimum again, so they are
+         * discarded before appending the new value (and the same for the
+         * maximum deque with the entries that are not greater).
+         */
+        void push(T_ELEMENTS value)
+        {
+            if ( size() >= WINDOW_SIZE )
+                pop();
+
+            while ( !min_deque.empty() && !(min_deque.back().value < value) )
+                min_deque.pop_back();
+            min_deque.push_back(value, next_seq);
+
+            while ( !max_deque.empty() && !(value < max_deque.back().value) )
+                max_deque.pop_back();
+            max_deque.push_back(value, next_seq);
+
+            next_seq = next_seq + 1U;
+        }
+
+        /**
+         * @brief Removes the oldest value from the window. If the window is
+         * empty, do nothing.
+         */
+        void pop()
+        {
+            if ( empty() )
+                return;
+
+            if ( min_deque.front().seq == oldest_seq )
+                min_deque.pop_front();
+            if ( max_deque.front().seq == oldest_seq )
+                max_deque.pop_front();
+
+            oldest_seq = oldest_seq + 1U;
+        }
+
+        /**
+         * @brief Returns reference to the minimum value of the window.
+         *
+         * @return const T_ELEMENTS* Reference to the minimum value. If the
+         * window is empty, a nullptr is returned.
+         */
+        const T_ELEMENTS* min() const
+        {
+            if ( empty() )
+                return nullptr;
+
+            return &(min_deque.front().value);
+        }
+
+        /**
+         * @brief Returns reference to the maximum value of the window.
+         *
+         * @return const T_ELEMENTS* Reference to the maximum value. If the
+         * window is empty, a nullptr is returned.
+         */
+        const T_ELEMENTS* max() const
+        {
+            if ( empty() )
+                return nullptr;
+
+            return &(max_deque.front().value);
+        }
+
+    /*********************************/
+
+    private:
+
+        /* Private Data Types */
+
+        /**
+         * @brief Deque entry, a window value and its push sequence number.
+         */
+        struct t_entry
+        {
+            T_ELEMENTS value;
+            uint32_t seq;
+        };
+
+        /**
+         * @brief Fixed size double ended queue of entries on a circular
+         * buffer. It can hold WINDOW_SIZE entries, which is the maximum
+         * number of values in the window.
+         */
+        class t_deque
+        {
+            public:
+
+                void clear()
+                {
+                    first = 0U;
+                    count = 0U;
+                }
+
+                bool empty() const
+                {
+                    return ( count == 0U );
+                }
+
+                const t_entry& front() const
+                {
+                    return entries[first];
+                }
+
+                const t_entry& back() const
+                {
+                    return entries[index(count - 1U)];
+                }
+
+                void push_back(const T_ELEMENTS& value, uint32_t seq)
+                {
+                    t_entry& entry = entries[index(count)];
+                    entry.value = value;
+                    entry.seq = seq;
+                    count = count + 1U;
+                }
+
+                void pop_back()
+                {
+                    count = count - 1U;
+                }
+
+                void pop_front()
+                {
+                    first = index(1U);
+                    count = count - 1U;
+                }
+
+            private:
+
+                t_entry entries[WINDOW_SIZE];
+                uint32_t first;
+                uint32_t count;
+
+                uint32_t index(uint32_t i) const
+                {
+                    uint32_t idx = first + i;
+
+                    if ( idx >= WINDOW_SIZE )
+                        idx = idx - WINDOW_SIZE;
+
+                    return idx;
+                }
+        };
+
+        /* Private Attributes */
+
+        /**
+         * @brief Candidates to window minimum, increasing from the front.
+         */
+        t_deque min_deque;
+
+        /**
+         * @brief Candidates to window maximum, decreasing from the front.
+         */
+        t_deque max_deque;
+
+        /**
+         * @brief Sequence number of the oldest value in the window.
+         */
+        uint32_t oldest_seq;
+
+        /**
+         * @brief Sequence number of the next value to be pushed.
+         *
+         * @details
+         * The sequence numbers can wrap around, only its difference and
+         * equality are used.
+         */
+        uint32_t next_seq;
+};
+
+/*****************************************************************************/
+
+#endif /* STATIC_WINDOW_MIN_MAX_H_ */
@@ -0,0 +1,475 @@
+
+/**
+ * @file    swindowquantile.hpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    17-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * A static memory allocated sliding window order statistics tracker, to be
+ * used as a companion of a SQueue with the same size, that gives the median
+ * and any quantile of the last WINDOW_SIZE pushed values without copying
+ * and sorting the window.
+ *
+ * The implementation is based on a treap (a randomized balanced binary
+ * search tree) whose nodes are stored in a static array of WINDOW_SIZE
+ * nodes. The nodes are used as a circular buffer in the same way than the
+ * SQueue elements, so the node of the oldest value is known and can be
+ * removed from the tree when the value leaves the window. Each node stores
+ * the size of its subtree, so the k-th smallest value is found descending
+ * from the root. Push, pop and quantile queries are O(log N) expected.
+ *
+ * The tracker follows the same push() and pop() semantics than SQueue (a
+ * push in a full window removes the oldest value), so calling both with the
+ * same values keeps them in sync.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2022 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#ifndef STATIC_WINDOW_QUANTILE_H_
+#define STATIC_WINDOW_QUANTILE_H_
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ libraries
+#include <cstdint>
+
+/*****************************************************************************/
+
+/* Class Interface */
+
+template <typename T_ELEMENTS, uint32_t WINDOW_SIZE>
+class SWindowQuantile
+{
+    public:
+
+        /* Public Methods */
+
+        /**
+         * @brief Construct a SWindowQuantile object.
+         */
+        SWindowQuantile()
+        {
+            random_state = 0x9E3779B9U;
+            clear();
+        }
+
+        /**
+         * @brief Clear the window.
+         */
+        void clear()
+        {
+            root = NIL;
+            window_head = 0U;
+            window_tail = 0U;
+            num_values = 0U;
+        }
+
+        /**
+         * @brief Check if the window is empty.
+         *
+         * @return true if the window is empty.
+         *
+         * @return false otherwise.
+         */
+        bool empty() const
+        {
+            return ( num_values == 0U );
+        }
+
+        /**
+         * @brief Returns the number of values currently in the window.
+         *
+         * @return uint32_t The number of values in the window.
+         */
+        uint32_t size() const
+        {
+            return num_values;
+        }
+
+        /**
+         * @brief Appends a value to the window, removing the oldest one if
+         * the window is full.
+         *
+         * @param value The value to append.
+         */
+        void push(T_ELEMENTS value)
+        {
+            uint32_t node;
+
+            if ( num_values >= WINDOW_SIZE )
+                pop();
+
+            node = window_head;
+            nodes[node].value = value;
+            nodes[node].priority = next_random();
+            nodes[node].left = NIL;
+            nodes[node].right = NIL;
+            nodes[node].count = 1U;
+            root = insert(root, node);
+
+            window_head = next_index(window_head);
+            num_values = num_values + 1U;
+        }
+
+        /**
+         * @brief Removes the oldest value from the window. If the window is
+         * empty, do nothing.
+         */
+        void pop()
+        {
+            if ( empty() )
+                return;
+
+            root = erase(root, window_tail);
+            window_tail = next_index(window_tail);
+            num_values = num_values - 1U;
+        }
+
+        /**
+         * @brief Returns reference to the k-th smallest value of the window
+         * (k = 0 is the minimum and k = size()-1 is the maximum).
+         *
+         * @param k Rank of the value.
+         *
+         * @return const T_ELEMENTS* Reference to the value. If k is out of
+         * the window range, a nullptr is returned.
+         */
+        const T_ELEMENTS* kth(uint32_t k) const
+        {
+            uint32_t node = root;
+
+            if ( k >= num_values )
+                return nullptr;
+
+            while ( node != NIL )
+            {
+                uint32_t left_count = count(nodes[node].left);
+
+                if ( k < left_count )
+                    node = nodes[node].left;
+                else if ( k == left_count )
+                    break;
+                else
+                {
+                    k = k - left_count - 1U;
+                    node = nodes[node].right;
+                }
+            }
+
+            return &(nodes[node].value);
+        }
+
+        /**
+         * @brief Returns reference to the given quantile of the window.
+         *
+         * @param q Quantile in the range 0.0 to 1.0 (i.e. 0.95 for p95).
+         * Values out of the range are clamped to it, and NaN is taken as
+         * 0.0.
+         *
+         * @return const T_ELEMENTS* Reference to the value. If the window is
+         * empty, a nullptr is returned.
+         *
+         * @details
+         * The nearest rank method is used, so the returned value is always
+         * one of the window values: the smallest value that is greater or
+         * equal than q*size() of the window values.
+         */
+        const T_ELEMENTS* quantile(double q) const
+        {
+            uint32_t rank;
+            double position;
+
+            if ( empty() )
+                return nullptr;
+
+            // Keep the conversion to integer defined (NaN fails the check)
+            if ( !(q > 0.0) )
+                q = 0.0;
+            else if ( q > 1.0 )
+                q = 1.0;
+
+            position = q * num_values;
+            rank = static_cast<uint32_t>(position);
+            if ( static_cast<double>(rank) < position )
+                rank = rank + 1U;
+            if ( rank > 0U )
+                rank = rank - 1U;
+            if ( rank >= num_values )
+                rank = num_values - 1U;
+
+            return kth(rank);
+        }
+
+        /**
+         * @brief Returns reference to the median of the window (the lower
+         * one for an even number of values).
+         *
+         * @return const T_ELEMENTS* Reference to the value. If the window is
+         * empty, a nullptr is returned.
+         */
+        const T_ELEMENTS* median() const
+        {
+            if ( empty() )
+                return nullptr;
+
+            return kth((num_values - 1U) / 2U);
+        }
+
+    /*********************************/
+
+    private:
+
+        /* Private Constants */
+
+        /**
+         * @brief Null node index.
+         */
+        static const uint32_t NIL = WINDOW_SIZE;
+
+        /* Private Data Types */
+
+        /**
+         * @brief Tree node of a window value.
+         */
+        struct t_node
+        {
+            T_ELEMENTS value;
+            uint32_t priority;
+            uint32_t left;
+            uint32_t right;
+            uint32_t count;
+        };
+
+        /* Private Attributes */
+
+        /**
+         * @brief Tree nodes, used as a circular buffer of window values.
+         */
+        t_node nodes[WINDOW_SIZE];
+
+        /**
+         * @brief Tree root node index.
+         */
+        uint32_t root;
+
+        /**
+         * @brief Node index for the next pushed value.
+         */
+        uint32_t window_head;
+
+        /**
+         * @brief Node index of the oldest value.
+         */
+        uint32_t window_tail;
+
+        /**
+         * @brief Current number of values in the window.
+         */
+        uint32_t num_values;
+
+        /**
+         * @brief Xorshift random generator state for node priorities.
+         */
+        uint32_t random_state;
+
+        /******************************/
+
+        /* Private Methods */
+
+        /**
+         * @brief Get the next circular buffer node index.
+         * @param i Node index.
+         * @return uint32_t Next node index.
+         */
+        uint32_t next_index(uint32_t i) const
+        {
+            i = i + 1U;
+            return ( i >= WINDOW_SIZE ) ? 0U : i;
+        }
+
+        /**
+         * @brief Get a new node priority.
+         * @return uint32_t Pseudo random value.
+         */
+        uint32_t next_random()
+        {
+            random_state ^= random_state << 13;
+            random_state ^= random_state >> 17;
+            random_state ^= random_state << 5;
+            return random_state;
+        }
+
+        /**
+         * @brief Get the number of nodes of a subtree.
+         * @param node Subtree root node index.
+         * @return uint32_t Number of nodes.
+         */
+        uint32_t count(uint32_t node) const
+        {
+            return ( node == NIL ) ? 0U : nodes[node].count;
+        }
+
+        /**
+         * @brief Update the subtree size of a node from its children.
+         * @param node Node index.
+         */
+        void update(uint32_t node)
+        {
+            nodes[node].count =
+                count(nodes[node].left) + count(nodes[node].right) + 1U;
+        }
+
+        /**
+         * @brief Checks if a node goes before another one in the tree.
+         * @param a Node index.
+         * @param b Node index.
+         * @return true if node a goes before node b.
+         * @details
+         * The nodes are sorted by value and, for equal values, by node
+         * index, so every node has a unique position and can be found for
+         * its removal.
+         */
+        bool less(uint32_t a, uint32_t b) const
+        {
+            if ( nodes[a].value < nodes[b].value )
+                return true;
+            if ( nodes[b].value < nodes[a].value )
+                return false;
+            return ( a < b );
+        }
+
+        /**
+         * @brief Insert a node in a subtree.
+         * @param tree Subtree root node index.
+         * @param node Node index to insert.
+         * @return uint32_t New subtree root node index.
+         */
+        uint32_t insert(uint32_t tree, uint32_t node)
+        {
+            if ( tree == NIL )
+                return node;
+
+            if ( nodes[node].priority > nodes[tree].priority )
+            {
+                split(tree, node, nodes[node].left, nodes[node].right);
+                update(node);
+                return node;
+            }
+
+            if ( less(node, tree) )
+                nodes[tree].left = insert(nodes[tree].left, node);
+            else
+                nodes[tree].right = insert(nodes[tree].right, node);
+            update(tree);
+
+            return tree;
+        }
+
+        /**
+         * @brief Split a subtree in the nodes that goes before a given node
+         * and the ones that goes after it.
+         * @param tree Subtree root node index.
+         * @param node Node index used as split key.
+         * @param left Output root node index of the lower nodes.
+         * @param right Output root node index of the upper nodes.
+         */
+        void split(uint32_t tree, uint32_t node, uint32_t& left,
+                uint32_t& right)
+        {
+            if ( tree == NIL )
+            {
+                left = NIL;
+                right = NIL;
+                return;
+            }
+
+            if ( less(tree, node) )
+            {
+                split(nodes[tree].right, node, nodes[tree].right, right);
+                left = tree;
+            }
+            else
+            {
+                split(nodes[tree].left, node, left, nodes[tree].left);
+                right = tree;
+            }
+            update(tree);
+        }
+
+        /**
+         * @brief Merge two subtrees, where all the nodes of the left one go
+         * before the nodes of the right one.
+         * @param left Lower subtree root node index.
+         * @param right Upper subtree root node index.
+         * @return uint32_t Merged subtree root node index.
+         */
+        uint32_t merge(uint32_t left, uint32_t right)
+        {
+            if ( left == NIL )
+                return right;
+            if ( right == NIL )
+                return left;
+
+            if ( nodes[left].priority > nodes[right].priority )
+            {
+                nodes[left].right = merge(nodes[left].right, right);
+                update(left);
+                return left;
+            }
+
+            nodes[right].left = merge(left, nodes[right].left);
+            update(right);
+            return right;
+        }
+
+        /**
+         * @brief Remove a node from a subtree.
+         * @param tree Subtree root node index.
+         * @param node Node index to remove.
+         * @return uint32_t New subtree root node index.
+         */
+        uint32_t erase(uint32_t tree, uint32_t node)
+        {
+            if ( tree == NIL )
+                return NIL;
+
+            if ( tree == node )
+                return merge(nodes[tree].left, nodes[tree].right);
+
+            if ( less(node, tree) )
+                nodes[tree].left = erase(nodes[tree].left, node);
+            else
+                nodes[tree].right = erase(nodes[tree].right, node);
+            update(tree);
+
+            return tree;
+        }
+};
+
+/*****************************************************************************/
+
+#endif /* STATIC_WINDOW_QUANTILE_H_ */
@@ -0,0 +1,79 @@
+
+/**
+ * @file    stest.hpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    17-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Minimal check macros for the SQueue tests, so the tests do not depend on
+ * any test framework. Each failed check is printed with its location, and
+ * the test program returns the number of failed checks.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2022 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#ifndef STATIC_QUEUE_TEST_H_
+#define STATIC_QUEUE_TEST_H_
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ libraries
+#include <cstdio>
+
+/*****************************************************************************/
+
+/* Check Macros */
+
+/**
+ * @brief Number of failed checks of the test program.
+ */
+static int stest_failures = 0;
+
+/**
+ * @brief Check that a condition is true, printing it if it fails.
+ */
+#define STEST_CHECK(condition) \
+    do \
+    { \
+        if ( !(condition) ) \
+        { \
+            std::printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, \
+                    #condition); \
+            stest_failures = stest_failures + 1; \
+        } \
+    } while ( 0 )
+
+/**
+ * @brief Print the test result and get the test program exit code.
+ */
+#define STEST_RESULT(name) \
+    ( std::printf("%s: %s\n", (name), \
+            ( stest_failures == 0 ) ? "OK" : "FAILED"), stest_failures )
+
+/*****************************************************************************/
+
+#endif /* STATIC_QUEUE_TEST_H_ */
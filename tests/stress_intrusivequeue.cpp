@@ -0,0 +1,128 @@
+/**
+ * @file    stress_intrusivequeue.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    17-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * SIntrusiveMpscQueue stress test, to be built with ThreadSanitizer
+ * (make tsan): three producer threads link their own nodes while the
+ * consumer thread unlinks them, checking that every node is received once
+ * and in the order of its producer.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2022 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ libraries
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+// Intrusive Queues
+#include "sintrusivequeue.hpp"
+
+// Test checks
+#include "stest.hpp"
+
+/*****************************************************************************/
+
+/* Test Configuration */
+
+static const uint32_t PRODUCERS = 3U;
+
+static const uint32_t NODES = 20000U;
+
+/*****************************************************************************/
+
+/* Test Data Types */
+
+struct t_node : public SMpscQueueHook
+{
+    uint32_t producer;
+    uint32_t sequence;
+};
+
+/*****************************************************************************/
+
+/* Tests */
+
+static void test_producers_stress()
+{
+    static t_node nodes[PRODUCERS][NODES];
+    SIntrusiveMpscQueue<t_node> queue;
+    std::vector<std::thread> producers;
+    uint32_t next[PRODUCERS] = { 0U };
+    uint32_t received = 0U;
+    bool in_order = true;
+
+    for ( uint32_t p = 0U; p < PRODUCERS; p++ )
+    {
+        producers.emplace_back(
+            [&queue, p]()
+            {
+                for ( uint32_t i = 0U; i < NODES; i++ )
+                {
+                    nodes[p][i].producer = p;
+                    nodes[p][i].sequence = i;
+                    queue.push(&(nodes[p][i]));
+                }
+            });
+    }
+
+    while ( received < (PRODUCERS * NODES) )
+    {
+        t_node* node = queue.pop();
+
+        if ( node == nullptr )
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        if ( (node->producer >= PRODUCERS) ||
+             (node->sequence != next[node->producer]) )
+            in_order = false;
+        else
+            next[node->producer] = next[node->producer] + 1U;
+        received = received + 1U;
+    }
+
+    for ( uint32_t p = 0U; p < PRODUCERS; p++ )
+        producers[p].join();
+
+    STEST_CHECK(in_order);
+    STEST_CHECK(queue.pop() == nullptr);
+    STEST_CHECK(queue.empty());
+}
+
+/*****************************************************************************/
+
+/* Main Function */
+
+int main()
+{
+    test_producers_stress();
+
+    return STEST_RESULT("stress_intrusivequeue");
+}
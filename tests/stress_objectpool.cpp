@@ -0,0 +1,142 @@
+/**
+ * @file    stress_objectpool.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    17-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * SPooledMpscQueue stress test, to be run with ThreadSanitizer: several
+ * producer threads acquire elements of a small pool (that runs out often),
+ * fill them in place and push them, while the consumer checks the per
+ * producer order and the payload of each element before popping it.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2022 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ libraries
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+// Object pools
+#include "sobjectpool.hpp"
+
+// Test checks
+#include "stest.hpp"
+
+/*****************************************************************************/
+
+/* Test Configuration */
+
+static const uint32_t PRODUCERS = 3U;
+
+static const uint32_t MESSAGES = 20000U;
+
+static const uint32_t POOL_SIZE = 16U;
+
+/*****************************************************************************/
+
+/* Test Data Types */
+
+struct t_message
+{
+    uint32_t producer;
+    uint32_t sequence;
+    uint32_t payload[14];
+};
+
+/*****************************************************************************/
+
+/* Tests */
+
+static void test_producers_stress()
+{
+    static SPooledMpscQueue<t_message, POOL_SIZE> queue;
+    std::vector<std::thread> producers;
+    uint32_t next[PRODUCERS] = { 0U };
+    uint32_t received = 0U;
+    bool in_order = true;
+
+    for ( uint32_t p = 0U; p < PRODUCERS; p++ )
+    {
+        producers.emplace_back(
+            [p]()
+            {
+                for ( uint32_t i = 0U; i < MESSAGES; i++ )
+                {
+                    t_message* message = queue.acquire();
+
+                    while ( message == nullptr )
+                    {
+                        std::this_thread::yield();
+                        message = queue.acquire();
+                    }
+                    message->producer = p;
+                    message->sequence = i;
+                    for ( uint32_t j = 0U; j < 14U; j++ )
+                        message->payload[j] = i + j;
+                    queue.push(message);
+                }
+            });
+    }
+
+    while ( received < (PRODUCERS * MESSAGES) )
+    {
+        t_message* message = queue.front();
+
+        if ( message == nullptr )
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        if ( (message->producer >= PRODUCERS) ||
+             (message->sequence != next[message->producer]) ||
+             (message->payload[13] != (message->sequence + 13U)) )
+            in_order = false;
+        else
+            next[message->producer] = next[message->producer] + 1U;
+        queue.pop();
+        received = received + 1U;
+    }
+
+    for ( uint32_t p = 0U; p < PRODUCERS; p++ )
+        producers[p].join();
+
+    STEST_CHECK(in_order);
+    STEST_CHECK(queue.empty());
+    STEST_CHECK(queue.front() == nullptr);
+    STEST_CHECK(queue.available() == POOL_SIZE);
+}
+
+/*****************************************************************************/
+
+/* Main Function */
+
+int main()
+{
+    test_producers_stress();
+
+    return STEST_RESULT("stress_objectpool");
+}
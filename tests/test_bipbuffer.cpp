@@ -0,0 +1,204 @@
+
+/**
+ * @file    test_bipbuffer.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    17-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * SBipBuffer tests: elements released between a reserve() and its commit()
+ * call, and a random sequence of reservations, commits and releases checked
+ * against a reference FIFO model.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2022 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ libraries
+#include <cstdint>
+#include <deque>
+#include <random>
+
+// Bip-buffer
+#include "sbipbuffer.hpp"
+
+// Test checks
+#include "stest.hpp"
+
+/*****************************************************************************/
+
+/* Test Helpers */
+
+/**
+ * @brief Write consecutive values to a reserved block.
+ */
+static void fill(uint32_t* block, uint32_t n, uint32_t first)
+{
+    for ( uint32_t i = 0U; i < n; i++ )
+        block[i] = first + i;
+}
+
+/*****************************************************************************/
+
+/* Tests */
+
+static void test_release_all_before_commit_in_a()
+{
+    SBipBuffer<uint32_t, 16> bip;
+    uint32_t* block;
+    uint32_t n;
+
+    block = bip.reserve(4U);
+    fill(block, 4U, 100U);
+    STEST_CHECK(bip.commit(4U));
+
+    block = bip.reserve(4U);
+    STEST_CHECK(block != nullptr);
+    fill(block, 4U, 200U);
+    bip.release(4U);
+    STEST_CHECK(bip.empty());
+    STEST_CHECK(bip.commit(4U));
+
+    STEST_CHECK(bip.size() == 4U);
+    block = bip.get_block(&n);
+    STEST_CHECK((block != nullptr) && (n == 4U));
+    if ( block != nullptr )
+        STEST_CHECK((block[0] == 200U) && (block[3] == 203U));
+}
+
+static void test_release_all_before_commit_in_new_b()
+{
+    SBipBuffer<uint32_t, 8> bip;
+    uint32_t* block;
+    uint32_t n;
+
+    // Region A at [3, 7), no room after it for 3 elements
+    block = bip.reserve(7U);
+    fill(block, 7U, 0U);
+    STEST_CHECK(bip.commit(7U));
+    bip.release(3U);
+
+    block = bip.reserve(3U);
+    STEST_CHECK(block != nullptr);
+    fill(block, 3U, 300U);
+    bip.release(4U);
+    STEST_CHECK(bip.commit(3U));
+
+    STEST_CHECK(bip.size() == 3U);
+    block = bip.get_block(&n);
+    STEST_CHECK((block != nullptr) && (n == 3U));
+    if ( block != nullptr )
+        STEST_CHECK((block[0] == 300U) && (block[2] == 302U));
+}
+
+static void test_release_all_before_commit_in_active_b()
+{
+    SBipBuffer<uint32_t, 8> bip;
+    uint32_t* block;
+    uint32_t n;
+
+    // Region A at [4, 7) and region B at [0, 2)
+    block = bip.reserve(7U);
+    fill(block, 7U, 0U);
+    STEST_CHECK(bip.commit(7U));
+    bip.release(4U);
+    block = bip.reserve(2U);
+    fill(block, 2U, 10U);
+    STEST_CHECK(bip.commit(2U));
+
+    // Reservation at [2, 4), then the region B becomes the region A
+    block = bip.reserve(2U);
+    STEST_CHECK(block != nullptr);
+    fill(block, 2U, 12U);
+    bip.release(3U);
+    STEST_CHECK(bip.commit(2U));
+
+    STEST_CHECK(bip.size() == 4U);
+    block = bip.get_block(&n);
+    STEST_CHECK((block != nullptr) && (n == 4U));
+    if ( block != nullptr )
+        STEST_CHECK((block[0] == 10U) && (block[3] == 13U));
+}
+
+static void test_random_against_model()
+{
+    SBipBuffer<uint32_t, 64> bip;
+    std::deque<uint32_t> model;
+    std::mt19937 rng(1234U);
+    uint32_t next = 0U;
+
+    for ( uint32_t step = 0U; step < 200000U; step++ )
+    {
+        uint32_t want = 1U + (rng() % 24U);
+        uint32_t* block = bip.reserve(want);
+        uint32_t written = 0U;
+        uint32_t n;
+
+        if ( block != nullptr )
+        {
+            written = rng() % (want + 1U);
+            fill(block, written, next);
+        }
+
+        // Sometimes read before the commit
+        if ( (rng() % 3U) == 0U )
+        {
+            uint32_t* read = bip.get_block(&n);
+            uint32_t k = rng() % (n + 1U);
+
+            for ( uint32_t i = 0U; i < k; i++ )
+            {
+                STEST_CHECK(read[i] == model.front());
+                model.pop_front();
+            }
+            bip.release(k);
+        }
+
+        if ( block != nullptr )
+        {
+            STEST_CHECK(bip.commit(written));
+            for ( uint32_t i = 0U; i < written; i++ )
+                model.push_back(next + i);
+            next = next + written;
+        }
+
+        STEST_CHECK(bip.size() == model.size());
+        STEST_CHECK((bip.get_block(&n) == nullptr) == model.empty());
+        if ( stest_failures != 0 )
+            return;
+    }
+}
+
+/*****************************************************************************/
+
+/* Main Function */
+
+int main()
+{
+    test_release_all_before_commit_in_a();
+    test_release_all_before_commit_in_new_b();
+    test_release_all_before_commit_in_active_b();
+    test_random_against_model();
+
+    return STEST_RESULT("test_bipbuffer");
+}
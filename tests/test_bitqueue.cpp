@@ -0,0 +1,194 @@
+/**
+ * @file    test_bitqueue.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    17-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * SBitQueue tests against a std::deque model, for 1, 2 and 4 bits elements
+ * and Queue sizes that are not a multiple of the word elements: push (with
+ * overflows), pop, front, back, operator[], count and find, while the
+ * elements wrap around the buffer end.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2022 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ libraries
+#include <cstdint>
+#include <deque>
+#include <random>
+
+// Bit packed Queue
+#include "sbitqueue.hpp"
+
+// Test checks
+#include "stest.hpp"
+
+/*****************************************************************************/
+
+/* Test Helpers */
+
+/**
+ * @brief Check all the Queue elements and bulk operations against the
+ * model.
+ */
+template <uint32_t BITS, uint64_t SIZE>
+static void check_queue(const SBitQueue<BITS, SIZE>& queue,
+        const std::deque<uint8_t>& model, std::mt19937& rng)
+{
+    STEST_CHECK(queue.size() == model.size());
+    STEST_CHECK(queue.empty() == model.empty());
+    STEST_CHECK(queue.front() == ( model.empty() ? 0U : model.front() ));
+    STEST_CHECK(queue.back() == ( model.empty() ? 0U : model.back() ));
+
+    for ( size_t i = 0U; i < model.size(); i++ )
+        STEST_CHECK(queue[i] == model[i]);
+
+    for ( uint32_t value = 0U; value < (1U << BITS); value++ )
+    {
+        size_t expected_count = 0U;
+        size_t expected_first = model.size();
+        size_t from = rng() % (model.size() + 2U);
+        size_t expected_find = model.size();
+
+        for ( size_t i = model.size(); i > 0U; i-- )
+        {
+            if ( model[i - 1U] == value )
+            {
+                expected_count = expected_count + 1U;
+                expected_first = i - 1U;
+            }
+        }
+        for ( size_t i = from; i < model.size(); i++ )
+        {
+            if ( model[i] == value )
+            {
+                expected_find = i;
+                break;
+            }
+        }
+
+        STEST_CHECK(queue.count(static_cast<uint8_t>(value)) ==
+                expected_count);
+        STEST_CHECK(queue.find(static_cast<uint8_t>(value)) ==
+                expected_first);
+        STEST_CHECK(queue.find(static_cast<uint8_t>(value), from) ==
+                expected_find);
+    }
+}
+
+/*****************************************************************************/
+
+/* Tests */
+
+template <uint32_t BITS, uint64_t SIZE>
+static void test_against_model(uint32_t seed)
+{
+    static SBitQueue<BITS, SIZE> queue;
+    std::deque<uint8_t> model;
+    std::mt19937 rng(seed);
+    const uint8_t mask = static_cast<uint8_t>((1U << BITS) - 1U);
+
+    queue.clear();
+    for ( uint32_t step = 0U; step < 4000U; step++ )
+    {
+        uint32_t op = rng() % 100U;
+
+        if ( op < 55U )
+        {
+            // Any value, only its lower bits are stored
+            uint8_t value = static_cast<uint8_t>(rng());
+            bool full = ( model.size() == SIZE );
+
+            STEST_CHECK(queue.push(value) ==
+                    ( full ? BUFFER_OVERFLOW : BUFFER_OK ));
+            if ( full )
+                model.pop_front();
+            model.push_back(value & mask);
+        }
+        else if ( op < 97U )
+        {
+            queue.pop();
+            if ( !model.empty() )
+                model.pop_front();
+        }
+        else
+        {
+            queue.clear();
+            model.clear();
+        }
+
+        check_queue(queue, model, rng);
+        if ( stest_failures != 0 )
+            return;
+    }
+}
+
+template <uint32_t BITS>
+static void test_sizes(uint32_t seed)
+{
+    test_against_model<BITS, 1U>(seed);
+    test_against_model<BITS, 9U>(seed);
+    test_against_model<BITS, 17U>(seed);
+    test_against_model<BITS, 33U>(seed);
+    test_against_model<BITS, 64U>(seed);
+    test_against_model<BITS, 100U>(seed);
+}
+
+/**
+ * @brief A value written over the previous contents of a cleared Queue
+ * reads back exactly (no stale bits of the word).
+ */
+static void test_clear_zeroes_words()
+{
+    static SBitQueue<4U, 9U> queue;
+
+    for ( uint32_t i = 0U; i < 9U; i++ )
+        queue.push(0xFU);
+    queue.clear();
+    STEST_CHECK(queue.count(0U) == 0U);
+    queue.push(0U);
+    queue.push(5U);
+    STEST_CHECK(queue[0U] == 0U);
+    STEST_CHECK(queue[1U] == 5U);
+    STEST_CHECK(queue.count(0xFU) == 0U);
+    STEST_CHECK(queue.find(5U) == 1U);
+}
+
+/*****************************************************************************/
+
+/* Main Function */
+
+int main()
+{
+    test_clear_zeroes_words();
+    for ( uint32_t seed = 1U; seed <= 3U; seed++ )
+    {
+        test_sizes<1U>(seed);
+        test_sizes<2U>(seed);
+        test_sizes<4U>(seed);
+    }
+
+    return STEST_RESULT("test_bitqueue");
+}
@@ -0,0 +1,284 @@
+/**
+ * @file    test_bytequeue.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    17-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * SByteQueue tests: a record placed after a skip marker at the end of the
+ * buffer, a reservation with skip whose Queue gets empty before the commit,
+ * commits smaller than the reservation, the smallest buffers (8 and 12
+ * bytes), and random writes, reads and reservations against a std::deque
+ * of records.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2022 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ libraries
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <random>
+#include <vector>
+
+// Byte Queue
+#include "sbytequeue.hpp"
+
+// Test checks
+#include "stest.hpp"
+
+/*****************************************************************************/
+
+/* Test Helpers */
+
+/**
+ * @brief Write a record with all its bytes set to the given value.
+ */
+template <uint32_t BUFFER_SIZE>
+static bool push_filled(SByteQueue<BUFFER_SIZE>& queue, uint32_t size,
+        uint8_t value)
+{
+    std::vector<uint8_t> data(size, value);
+
+    return queue.push(data.data(), size);
+}
+
+/**
+ * @brief Check the size and the bytes of the front record.
+ */
+template <uint32_t BUFFER_SIZE>
+static bool front_is(const SByteQueue<BUFFER_SIZE>& queue, uint32_t size,
+        uint8_t value)
+{
+    uint32_t front_size = 0U;
+    const uint8_t* record = queue.front(&front_size);
+
+    if ( (record == nullptr) || (front_size != size) )
+        return false;
+    for ( uint32_t i = 0U; i < size; i++ )
+    {
+        if ( record[i] != value )
+            return false;
+    }
+
+    return true;
+}
+
+/*****************************************************************************/
+
+/* Tests */
+
+static void test_skip_marker_at_wrap()
+{
+    SByteQueue<64> queue;
+
+    // Records of 24 bytes at [0, 24) and [24, 48), then [0, 24) is freed
+    STEST_CHECK(push_filled(queue, 20U, 1U));
+    STEST_CHECK(push_filled(queue, 20U, 2U));
+    queue.pop();
+
+    // Only 16 bytes left at the end, so the record goes to the start
+    STEST_CHECK(push_filled(queue, 20U, 3U));
+    STEST_CHECK(queue.used() == 64U);
+    STEST_CHECK(!push_filled(queue, 0U, 4U));
+
+    STEST_CHECK(front_is(queue, 20U, 2U));
+    queue.pop();
+    STEST_CHECK(queue.used() == 24U);
+    STEST_CHECK(front_is(queue, 20U, 3U));
+    queue.pop();
+    STEST_CHECK(queue.empty());
+    STEST_CHECK(queue.used() == 0U);
+}
+
+static void test_empty_before_skip_commit()
+{
+    SByteQueue<64> queue;
+    uint8_t* record;
+
+    STEST_CHECK(push_filled(queue, 20U, 1U));
+    STEST_CHECK(push_filled(queue, 20U, 2U));
+    queue.pop();
+
+    // The reservation skips the end, then the last record is popped
+    record = queue.try_write(20U);
+    STEST_CHECK(record != nullptr);
+    if ( record == nullptr )
+        return;
+    memset(record, 3, 20U);
+    queue.pop();
+    STEST_CHECK(queue.empty());
+    STEST_CHECK(queue.commit(20U));
+
+    STEST_CHECK(queue.size() == 1U);
+    STEST_CHECK(queue.used() == 24U);
+    STEST_CHECK(front_is(queue, 20U, 3U));
+
+    // The rest of the buffer must be usable
+    STEST_CHECK(push_filled(queue, 36U, 4U));
+    STEST_CHECK(queue.used() == 64U);
+    queue.pop();
+    STEST_CHECK(front_is(queue, 36U, 4U));
+    queue.pop();
+    STEST_CHECK(queue.used() == 0U);
+}
+
+static void test_commit_smaller()
+{
+    SByteQueue<64> queue;
+    uint8_t* record;
+
+    STEST_CHECK(!queue.commit(0U));
+    record = queue.try_write(30U);
+    STEST_CHECK(record != nullptr);
+    if ( record == nullptr )
+        return;
+    memset(record, 5, 30U);
+    STEST_CHECK(!queue.commit(31U));
+    STEST_CHECK(queue.commit(9U));
+    STEST_CHECK(!queue.commit(9U));
+
+    // Only the committed size (padded) is in use
+    STEST_CHECK(queue.used() == 16U);
+    STEST_CHECK(front_is(queue, 9U, 5U));
+    STEST_CHECK(push_filled(queue, 44U, 6U));
+    STEST_CHECK(queue.used() == 64U);
+    queue.pop();
+    STEST_CHECK(front_is(queue, 44U, 6U));
+}
+
+static void test_smallest_buffers()
+{
+    SByteQueue<8> tiny;
+    SByteQueue<12> small;
+
+    STEST_CHECK(SByteQueue<8>::max_record_size() == 4U);
+    STEST_CHECK(!push_filled(tiny, 5U, 1U));
+    STEST_CHECK(push_filled(tiny, 4U, 1U));
+    STEST_CHECK(!push_filled(tiny, 0U, 2U));
+    STEST_CHECK(front_is(tiny, 4U, 1U));
+    tiny.pop();
+    STEST_CHECK(push_filled(tiny, 0U, 2U));
+    STEST_CHECK(push_filled(tiny, 0U, 3U));
+    STEST_CHECK(tiny.size() == 2U);
+    STEST_CHECK(tiny.used() == 8U);
+
+    // A 2 bytes record does not fit in the last 4 bytes, it needs a skip
+    STEST_CHECK(push_filled(small, 2U, 1U));
+    STEST_CHECK(push_filled(small, 0U, 2U));
+    small.pop();
+    STEST_CHECK(push_filled(small, 2U, 3U));
+    STEST_CHECK(small.used() == 12U);
+    STEST_CHECK(front_is(small, 0U, 2U));
+    small.pop();
+    STEST_CHECK(front_is(small, 2U, 3U));
+    small.pop();
+    STEST_CHECK(small.empty() && (small.used() == 0U));
+}
+
+/**
+ * @brief Random records, reservations with reads and with smaller commits,
+ * compared with a std::deque of records.
+ */
+template <uint32_t BUFFER_SIZE>
+static void run_against_model(uint32_t seed)
+{
+    SByteQueue<BUFFER_SIZE> queue;
+    std::deque<std::vector<uint8_t>> model;
+    std::mt19937 rng(seed);
+    uint8_t next = 0U;
+
+    for ( uint32_t step = 0U; step < 100000U; step++ )
+    {
+        uint32_t want = rng() % (BUFFER_SIZE - 2U);
+        bool was_empty = model.empty();
+        uint8_t* record = queue.try_write(want);
+        uint32_t written = 0U;
+
+        // A record of the maximum size always fits in an empty Queue
+        STEST_CHECK((record != nullptr) || !was_empty ||
+                (want > SByteQueue<BUFFER_SIZE>::max_record_size()));
+
+        if ( record != nullptr )
+        {
+            written = ( (rng() % 4U) == 0U ) ? rng() % (want + 1U) : want;
+            memset(record, next, written);
+        }
+
+        // Sometimes read before the commit
+        if ( (rng() % 3U) == 0U )
+        {
+            uint32_t k = rng() % (static_cast<uint32_t>(model.size()) + 1U);
+
+            for ( uint32_t i = 0U; i < k; i++ )
+            {
+                STEST_CHECK(front_is(queue,
+                        static_cast<uint32_t>(model.front().size()),
+                        model.front().empty() ? 0U : model.front()[0]));
+                queue.pop();
+                model.pop_front();
+            }
+        }
+
+        if ( record != nullptr )
+        {
+            STEST_CHECK(queue.commit(written));
+            model.push_back(std::vector<uint8_t>(written, next));
+            next = static_cast<uint8_t>(next + 1U);
+        }
+
+        STEST_CHECK(queue.size() == model.size());
+        STEST_CHECK(queue.used() <= BUFFER_SIZE);
+        STEST_CHECK((queue.used() == 0U) == model.empty());
+        if ( !model.empty() )
+        {
+            STEST_CHECK(front_is(queue,
+                    static_cast<uint32_t>(model.front().size()),
+                    model.front().empty() ? 0U : model.front()[0]));
+        }
+        if ( stest_failures != 0 )
+            return;
+    }
+}
+
+/*****************************************************************************/
+
+/* Main Function */
+
+int main()
+{
+    test_skip_marker_at_wrap();
+    test_empty_before_skip_commit();
+    test_commit_smaller();
+    test_smallest_buffers();
+    for ( uint32_t seed = 1U; seed <= 4U; seed++ )
+    {
+        run_against_model<8>(seed);
+        run_against_model<12>(seed);
+        run_against_model<64>(seed);
+        run_against_model<1000>(seed);
+    }
+
+    return STEST_RESULT("test_bytequeue");
+}
@@ -0,0 +1,285 @@
+/**
+ * @file    test_drrqueue.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    17-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * SDrrQueue tests against a reference deficit round robin built on
+ * std::deque lanes: random pushes (with lane overflows) and dequeues with
+ * unit costs and with byte costs, including weights lower than the maximum
+ * element cost (several turns without serving any element), the exact
+ * dequeue order of two backlogged lanes, and the served counters.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2022 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ libraries
+#include <cstdint>
+#include <deque>
+#include <random>
+
+// Deficit round robin Queue
+#include "sdrrqueue.hpp"
+
+// Test checks
+#include "stest.hpp"
+
+/*****************************************************************************/
+
+/* Test Data Types */
+
+struct t_item
+{
+    uint32_t lane;
+    uint32_t id;
+    uint32_t size;
+};
+
+/**
+ * @brief Cost function for weights in bytes.
+ */
+struct t_bytes_cost
+{
+    uint32_t operator()(const t_item& item) const
+    {
+        return item.size;
+    }
+};
+
+/*****************************************************************************/
+
+/* Test Helpers */
+
+/**
+ * @brief Reference deficit round robin scheduler.
+ */
+template <uint32_t LANE_SIZE, uint32_t NUM_LANES, typename T_COST>
+struct t_reference
+{
+    std::deque<t_item> lanes[NUM_LANES];
+    std::deque<uint32_t> active;
+    uint64_t deficits[NUM_LANES] = { 0U };
+    uint32_t weights[NUM_LANES];
+    uint64_t served[NUM_LANES] = { 0U };
+    uint64_t served_costs[NUM_LANES] = { 0U };
+    bool turn_started = false;
+    T_COST cost;
+
+    void push(const t_item& item)
+    {
+        if ( lanes[item.lane].empty() )
+            active.push_back(item.lane);
+        if ( lanes[item.lane].size() == LANE_SIZE )
+            lanes[item.lane].pop_front();
+        lanes[item.lane].push_back(item);
+    }
+
+    /**
+     * @brief Dequeue the next element.
+     * @return false if all the lanes are empty.
+     */
+    bool pop(t_item& item)
+    {
+        while ( !active.empty() )
+        {
+            uint32_t lane = active.front();
+
+            if ( !turn_started )
+            {
+                deficits[lane] = deficits[lane] + weights[lane];
+                turn_started = true;
+            }
+
+            if ( cost(lanes[lane].front()) <= deficits[lane] )
+            {
+                item = lanes[lane].front();
+                lanes[lane].pop_front();
+                deficits[lane] = deficits[lane] - cost(item);
+                served[lane] = served[lane] + 1U;
+                served_costs[lane] = served_costs[lane] + cost(item);
+                if ( lanes[lane].empty() )
+                {
+                    deficits[lane] = 0U;
+                    active.pop_front();
+                    turn_started = false;
+                }
+                return true;
+            }
+
+            active.pop_front();
+            active.push_back(lane);
+            turn_started = false;
+        }
+
+        return false;
+    }
+};
+
+/**
+ * @brief Random pushes and dequeues on a DRR Queue and the reference one.
+ */
+template <uint32_t LANE_SIZE, uint32_t NUM_LANES, typename T_COST>
+static void run_against_reference(uint32_t seed, uint32_t max_weight,
+        uint32_t max_size)
+{
+    static SDrrQueue<t_item, LANE_SIZE, NUM_LANES, T_COST> queue;
+    t_reference<LANE_SIZE, NUM_LANES, T_COST> reference;
+    std::mt19937 rng(seed);
+    uint32_t next_id = 0U;
+
+    queue.clear();
+    for ( uint32_t lane = 0U; lane < NUM_LANES; lane++ )
+    {
+        reference.weights[lane] = 1U + (rng() % max_weight);
+        STEST_CHECK(queue.set_weight(lane, reference.weights[lane]));
+    }
+
+    for ( uint32_t step = 0U; step < 20000U; step++ )
+    {
+        if ( (rng() % 100U) < 52U )
+        {
+            // Some lanes get more elements than the other ones
+            uint32_t lane = rng() % NUM_LANES;
+            t_item item;
+
+            if ( (rng() % 2U) == 0U )
+                lane = lane % 3U;
+            item = t_item{ lane, next_id,
+                    static_cast<uint32_t>(1U + (rng() % max_size)) };
+            next_id = next_id + 1U;
+
+            STEST_CHECK(queue.push(lane, item) ==
+                    ( (reference.lanes[lane].size() == LANE_SIZE) ?
+                      BUFFER_OVERFLOW : BUFFER_OK ));
+            reference.push(item);
+        }
+        else
+        {
+            t_item expected;
+            bool any = reference.pop(expected);
+            t_item* item = queue.front();
+
+            STEST_CHECK(( item != nullptr ) == any);
+            if ( (item != nullptr) && any )
+            {
+                STEST_CHECK(item->lane == expected.lane);
+                STEST_CHECK(item->id == expected.id);
+            }
+            queue.pop();
+        }
+
+        STEST_CHECK(queue.empty() == reference.active.empty());
+        if ( stest_failures != 0 )
+            return;
+    }
+
+    for ( uint32_t lane = 0U; lane < NUM_LANES; lane++ )
+    {
+        STEST_CHECK(queue.lane(lane)->size() ==
+                reference.lanes[lane].size());
+        STEST_CHECK(queue.served_count(lane) == reference.served[lane]);
+        STEST_CHECK(queue.served_cost(lane) == reference.served_costs[lane]);
+    }
+}
+
+/*****************************************************************************/
+
+/* Tests */
+
+/**
+ * @brief Two backlogged lanes with weights 1 and 3 are served in the
+ * exact DRR order.
+ */
+static void test_weighted_order()
+{
+    static SDrrQueue<t_item, 16, 2> queue;
+    const uint32_t expected[] = { 0U, 1U, 1U, 1U, 0U, 1U, 1U, 1U };
+
+    queue.set_weight(1U, 3U);
+    for ( uint32_t i = 0U; i < 8U; i++ )
+    {
+        queue.push(0U, t_item{ 0U, i, 1U });
+        queue.push(1U, t_item{ 1U, i, 1U });
+    }
+
+    for ( uint32_t i = 0U; i < 8U; i++ )
+    {
+        STEST_CHECK(queue.front()->lane == expected[i]);
+        queue.pop();
+    }
+    STEST_CHECK(queue.served_count(0U) == 2U);
+    STEST_CHECK(queue.served_count(1U) == 6U);
+    STEST_CHECK(queue.served_count(2U) == 0U);
+    STEST_CHECK(!queue.set_weight(2U, 1U));
+}
+
+/**
+ * @brief A lane whose weight is lower than its element cost needs several
+ * turns to serve it, while a lane with enough weight is served on each of
+ * its turns.
+ */
+static void test_weight_below_cost()
+{
+    static SDrrQueue<t_item, 16, 2, t_bytes_cost> queue;
+
+    queue.set_weight(0U, 100U);
+    queue.set_weight(1U, 1000U);
+    queue.push(0U, t_item{ 0U, 0U, 1000U });
+    for ( uint32_t i = 0U; i < 12U; i++ )
+        queue.push(1U, t_item{ 1U, i, 1000U });
+
+    // Lane 0 gets 100 bytes per turn, so it is served on its 10th turn
+    for ( uint32_t i = 0U; i < 9U; i++ )
+    {
+        STEST_CHECK(queue.front()->lane == 1U);
+        queue.pop();
+    }
+    STEST_CHECK(queue.front()->lane == 0U);
+    queue.pop();
+    STEST_CHECK(queue.served_cost(0U) == 1000U);
+    STEST_CHECK(queue.served_count(1U) == 9U);
+}
+
+/*****************************************************************************/
+
+/* Main Function */
+
+int main()
+{
+    test_weighted_order();
+    test_weight_below_cost();
+    for ( uint32_t seed = 1U; seed <= 5U; seed++ )
+    {
+        // Unit costs
+        run_against_reference<8, 5, SDrrUnitCost>(seed, 4U, 1U);
+        run_against_reference<4, 64, SDrrUnitCost>(seed, 8U, 1U);
+
+        // Byte costs, with weights above and below the maximum cost
+        run_against_reference<8, 5, t_bytes_cost>(seed, 3000U, 1500U);
+        run_against_reference<8, 7, t_bytes_cost>(seed, 200U, 1500U);
+    }
+
+    return STEST_RESULT("test_drrqueue");
+}
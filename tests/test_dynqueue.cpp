@@ -0,0 +1,234 @@
+
+/**
+ * @file    test_dynqueue.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    17-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * SQueue storage tests: capacity rounding of SDynQueue, caller buffers
+ * that must have a power of two size, storages of external buffers that
+ * can be moved but not copied, and Queues without buffer (capacity 0,
+ * failed allocation, caller buffer not a power of two, default span
+ * storage, exhausted arena, and failed huge page and NUMA mappings of
+ * fixed size Queues) that must stay empty and reject every push.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2022 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ libraries
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+// Queue storages
+#include "sarenastorage.hpp"
+#include "sheapstorage.hpp"
+#include "shugepagestorage.hpp"
+#include "snumastorage.hpp"
+#include "sspanstorage.hpp"
+
+// Test checks
+#include "stest.hpp"
+
+/*****************************************************************************/
+
+/* Test Helpers */
+
+/**
+ * @brief Check that a Queue without buffer is empty and stays empty.
+ */
+template <typename T_QUEUE>
+static void check_no_buffer(T_QUEUE& queue)
+{
+    uint32_t calls = 0U;
+
+    STEST_CHECK(queue.capacity() == 0U);
+    STEST_CHECK(queue.push(1) == BUFFER_OVERFLOW);
+    STEST_CHECK(queue.push(2) == BUFFER_OVERFLOW);
+    STEST_CHECK(queue.empty());
+    STEST_CHECK(queue.size() == 0U);
+    STEST_CHECK(queue.front() == nullptr);
+    STEST_CHECK(queue.back() == nullptr);
+    STEST_CHECK(queue.at(0U) == nullptr);
+    queue.pop();
+    STEST_CHECK(queue.drain([&](int32_t&) { calls = calls + 1U; }) == 0U);
+    queue.for_each_segment([&](int32_t*, size_t) { calls = calls + 1U; });
+    STEST_CHECK(calls == 0U);
+    STEST_CHECK(queue.begin() == queue.end());
+    STEST_CHECK(queue.empty());
+}
+
+/*****************************************************************************/
+
+/* Tests */
+
+static void test_capacity_zero()
+{
+    SDynQueue<int32_t> queue(0U);
+
+    STEST_CHECK(!queue.storage().valid());
+    check_no_buffer(queue);
+}
+
+static void test_failed_allocation()
+{
+    SDynQueue<int32_t> queue(static_cast<size_t>(-1) / 2U);
+
+    STEST_CHECK(!queue.storage().valid());
+    check_no_buffer(queue);
+}
+
+static void test_empty_caller_buffer()
+{
+    SDynQueue<int32_t> queue(nullptr, 16U);
+
+    check_no_buffer(queue);
+}
+
+static void test_default_span_storage()
+{
+    SQueue<int32_t, SQUEUE_DYNAMIC_SIZE, SQueueSpanStorage> queue;
+
+    check_no_buffer(queue);
+}
+
+static void test_exhausted_arena()
+{
+    typedef SQueue<int32_t, SQUEUE_DYNAMIC_SIZE, SQueueArenaStorage> t_queue;
+    static uint8_t memory[256];
+    SQueueArena arena(memory, sizeof(memory));
+    t_queue first(t_queue::storage_type(arena, 32U));
+    t_queue second(t_queue::storage_type(arena, 64U));
+
+    STEST_CHECK(first.capacity() == 32U);
+    STEST_CHECK(first.push(1) == BUFFER_OK);
+    check_no_buffer(second);
+}
+
+/**
+ * @brief Fixed size Queues whose buffer does not fit in the address space,
+ * so the mapping always fails.
+ */
+static void test_failed_mapping()
+{
+    static const uint64_t HUGE_SIZE = static_cast<uint64_t>(1U) << 48;
+    static SQueue<int32_t, HUGE_SIZE, SQueueHugePageStorage> huge;
+    static SQueue<int32_t, HUGE_SIZE, SQueueNumaStorage> numa;
+
+    STEST_CHECK(!huge.storage().valid());
+    check_no_buffer(huge);
+    STEST_CHECK(!numa.storage().valid());
+    check_no_buffer(numa);
+}
+
+/**
+ * @brief Caller buffers are used whole, a size that is not a power of two
+ * gives a Queue without buffer instead of a smaller capacity.
+ */
+static void test_caller_buffer_size()
+{
+    typedef SQueue<int32_t, SQUEUE_DYNAMIC_SIZE, SQueueSpanStorage> t_queue;
+    static int32_t memory[1024];
+    SDynQueue<int32_t> heap_odd(memory, 1000U);
+    SDynQueue<int32_t> heap(memory, 1024U);
+    t_queue span_odd(t_queue::storage_type(memory, 3U));
+    t_queue span(t_queue::storage_type(memory, 512U));
+
+    STEST_CHECK(!heap_odd.storage().valid());
+    check_no_buffer(heap_odd);
+    STEST_CHECK(!span_odd.storage().valid());
+    check_no_buffer(span_odd);
+
+    STEST_CHECK(heap.capacity() == 1024U);
+    STEST_CHECK(span.capacity() == 512U);
+    STEST_CHECK(span.push(7) == BUFFER_OK);
+    STEST_CHECK(*(span.front()) == 7);
+}
+
+/**
+ * @brief Queues over an external buffer can not be copied, and a move
+ * leaves the source without buffer.
+ */
+static void test_external_buffer_move()
+{
+    typedef SQueue<int32_t, SQUEUE_DYNAMIC_SIZE, SQueueSpanStorage> t_span;
+    typedef SQueue<int32_t, SQUEUE_DYNAMIC_SIZE, SQueueArenaStorage> t_arena;
+    static int32_t memory[16];
+    static uint8_t arena_memory[256];
+    SQueueArena arena(arena_memory, sizeof(arena_memory));
+    t_span source(t_span::storage_type(memory, 16U));
+    t_arena arena_source(t_arena::storage_type(arena, 16U));
+
+    static_assert(!std::is_copy_constructible<t_span>::value &&
+            !std::is_copy_assignable<t_span>::value,
+            "Span storage Queues must not be copyable");
+    static_assert(!std::is_copy_constructible<t_arena>::value &&
+            !std::is_copy_assignable<t_arena>::value,
+            "Arena storage Queues must not be copyable");
+
+    source.push(1);
+    source.push(2);
+    t_span target(std::move(source));
+    STEST_CHECK(!source.storage().valid());
+    STEST_CHECK(target.capacity() == 16U);
+    STEST_CHECK((target.size() == 2U) && (*(target.front()) == 1));
+
+    arena_source.push(3);
+    t_arena arena_target(std::move(arena_source));
+    STEST_CHECK(!arena_source.storage().valid());
+    STEST_CHECK(*(arena_target.front()) == 3);
+}
+
+static void test_capacity_rounding()
+{
+    SDynQueue<int32_t> queue(5U);
+
+    STEST_CHECK(queue.storage().valid());
+    STEST_CHECK(queue.capacity() == 8U);
+    for ( int32_t i = 0; i < 11; i++ )
+        queue.push(i);
+    STEST_CHECK(queue.size() == 8U);
+    STEST_CHECK(*(queue.front()) == 3);
+    STEST_CHECK(*(queue.back()) == 10);
+}
+
+/*****************************************************************************/
+
+/* Main Function */
+
+int main()
+{
+    test_capacity_zero();
+    test_failed_allocation();
+    test_empty_caller_buffer();
+    test_default_span_storage();
+    test_exhausted_arena();
+    test_failed_mapping();
+    test_caller_buffer_size();
+    test_external_buffer_move();
+    test_capacity_rounding();
+
+    return STEST_RESULT("test_dynqueue");
+}
@@ -0,0 +1,208 @@
+/**
+ * @file    test_intrusivequeue.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    17-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Intrusive Queues model tests: random push and pop sequences on
+ * SIntrusiveQueue and on SIntrusiveMpscQueue (from a single thread, where a
+ * pop only fails on an empty Queue) checked against a std::deque, with
+ * the popped elements linked again later.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2022 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ libraries
+#include <cstdint>
+#include <deque>
+#include <random>
+#include <vector>
+
+// Intrusive Queues
+#include "sintrusivequeue.hpp"
+
+// Test checks
+#include "stest.hpp"
+
+/*****************************************************************************/
+
+/* Test Data Types */
+
+struct t_node : public SQueueHook
+{
+    uint32_t id;
+    bool linked;
+};
+
+struct t_mpsc_node : public SMpscQueueHook
+{
+    uint32_t id;
+    bool linked;
+};
+
+static const uint32_t NUM_NODES = 64U;
+
+/*****************************************************************************/
+
+/* Test Helpers */
+
+/**
+ * @brief Get a random node that is not linked, if any.
+ */
+template <typename T_NODE>
+static T_NODE* unlinked_node(T_NODE* nodes, std::mt19937& rng)
+{
+    uint32_t first = rng() % NUM_NODES;
+
+    for ( uint32_t i = 0U; i < NUM_NODES; i++ )
+    {
+        T_NODE* node = &(nodes[(first + i) % NUM_NODES]);
+
+        if ( !node->linked )
+            return node;
+    }
+
+    return nullptr;
+}
+
+/*****************************************************************************/
+
+/* Tests */
+
+static void test_queue_against_model(uint32_t seed)
+{
+    static t_node nodes[NUM_NODES];
+    SIntrusiveQueue<t_node> queue;
+    std::deque<t_node*> model;
+    std::mt19937 rng(seed);
+
+    for ( uint32_t i = 0U; i < NUM_NODES; i++ )
+    {
+        nodes[i].id = i;
+        nodes[i].linked = false;
+    }
+
+    for ( uint32_t step = 0U; step < 20000U; step++ )
+    {
+        uint32_t op = rng() % 100U;
+
+        if ( op < 50U )
+        {
+            t_node* node = unlinked_node(nodes, rng);
+
+            if ( node != nullptr )
+            {
+                queue.push(node);
+                node->linked = true;
+                model.push_back(node);
+            }
+        }
+        else if ( op < 98U )
+        {
+            queue.pop();
+            if ( !model.empty() )
+            {
+                model.front()->linked = false;
+                model.pop_front();
+            }
+        }
+        else
+        {
+            queue.clear();
+            for ( t_node* node : model )
+                node->linked = false;
+            model.clear();
+        }
+
+        STEST_CHECK(queue.size() == model.size());
+        STEST_CHECK(queue.empty() == model.empty());
+        STEST_CHECK(queue.front() == ( model.empty() ? nullptr :
+                model.front() ));
+        STEST_CHECK(queue.back() == ( model.empty() ? nullptr :
+                model.back() ));
+        if ( stest_failures != 0 )
+            return;
+    }
+}
+
+static void test_mpsc_against_model(uint32_t seed)
+{
+    static t_mpsc_node nodes[NUM_NODES];
+    SIntrusiveMpscQueue<t_mpsc_node> queue;
+    std::deque<t_mpsc_node*> model;
+    std::mt19937 rng(seed);
+
+    for ( uint32_t i = 0U; i < NUM_NODES; i++ )
+    {
+        nodes[i].id = i;
+        nodes[i].linked = false;
+    }
+
+    for ( uint32_t step = 0U; step < 20000U; step++ )
+    {
+        if ( (rng() % 2U) == 0U )
+        {
+            t_mpsc_node* node = unlinked_node(nodes, rng);
+
+            if ( node != nullptr )
+            {
+                queue.push(node);
+                node->linked = true;
+                model.push_back(node);
+            }
+        }
+        else
+        {
+            t_mpsc_node* node = queue.pop();
+
+            STEST_CHECK(node == ( model.empty() ? nullptr :
+                    model.front() ));
+            if ( !model.empty() )
+            {
+                model.front()->linked = false;
+                model.pop_front();
+            }
+        }
+
+        STEST_CHECK(queue.empty() == model.empty());
+        if ( stest_failures != 0 )
+            return;
+    }
+}
+
+/*****************************************************************************/
+
+/* Main Function */
+
+int main()
+{
+    for ( uint32_t seed = 1U; seed <= 10U; seed++ )
+    {
+        test_queue_against_model(seed);
+        test_mpsc_against_model(seed);
+    }
+
+    return STEST_RESULT("test_intrusivequeue");
+}
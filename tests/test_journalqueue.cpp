@@ -0,0 +1,408 @@
+/**
+ * @file    test_journalqueue.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    17-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * SJournalQueue recovery tests for each durability level: the Queue
+ * reopened after a simulated process crash (closed without committing)
+ * holds the elements of the last commit (JOURNAL_SYNC_NONE and
+ * JOURNAL_SYNC_BATCH) or of the last flushed commit (JOURNAL_SYNC_PERIODIC),
+ * checked in a random push, pop, commit and reopen loop against a model of
+ * the live and synced records, with overwrites of recorded elements.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2022 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ libraries
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <random>
+
+// POSIX libraries
+#include <unistd.h>
+
+// Journal Queue
+#include "sjournalqueue.hpp"
+
+// Test checks
+#include "stest.hpp"
+
+/*****************************************************************************/
+
+/* Test Data Types */
+
+/**
+ * @brief Queue element.
+ */
+struct t_entry
+{
+    uint32_t id;
+    uint32_t check;
+};
+
+/**
+ * @brief Model of an element and the buffer slot it was written to.
+ */
+struct t_item
+{
+    uint32_t id;
+    uint32_t slot;
+};
+
+/**
+ * @brief Model of a Queue state (the live Queue or a record).
+ */
+struct t_state
+{
+    std::deque<t_item> items;
+    uint32_t tail;
+};
+
+static const uint32_t QUEUE_SIZE = 8U;
+
+typedef SJournalQueue<t_entry, QUEUE_SIZE> t_journal;
+
+/*****************************************************************************/
+
+/* Test Helpers */
+
+/**
+ * @brief Get a Queue file path unique to this test process.
+ */
+static void queue_path(char* path, size_t size, const char* name)
+{
+    std::snprintf(path, size, "/tmp/squeue_test_%s_%d", name,
+            static_cast<int>(getpid()));
+}
+
+static t_entry make_entry(uint32_t id)
+{
+    return t_entry{ id, id * 2654435761U };
+}
+
+/**
+ * @brief Pop all the Queue elements checking them against the expected
+ * ones.
+ */
+static void check_contents(t_journal& queue, const std::deque<t_item>& items)
+{
+    STEST_CHECK(queue.size() == items.size());
+    for ( const t_item& item : items )
+    {
+        t_entry* entry = queue.front();
+
+        STEST_CHECK(entry != nullptr);
+        if ( entry == nullptr )
+            return;
+        STEST_CHECK(entry->id == item.id);
+        STEST_CHECK(entry->check == (item.id * 2654435761U));
+        queue.pop();
+    }
+    STEST_CHECK(queue.empty());
+}
+
+/**
+ * @brief Model of the Queue and its live and synced records.
+ */
+struct t_model
+{
+    t_state live;
+    t_state committed;
+    t_state synced;
+    uint32_t next_id;
+    uint32_t commits_since_sync;
+
+    t_model() : live{ {}, 0U }, committed{ {}, 0U }, synced{ {}, 0U },
+        next_id(1U), commits_since_sync(0U)
+    {}
+
+    /**
+     * @brief A push writes the slot after the live elements, dropping the
+     * element of that slot from the front of the records.
+     */
+    void push()
+    {
+        uint32_t slot = (live.tail + static_cast<uint32_t>(
+                live.items.size())) % QUEUE_SIZE;
+
+        if ( live.items.size() == QUEUE_SIZE )
+            pop();
+        overwrite(committed, slot);
+        overwrite(synced, slot);
+        live.items.push_back(t_item{ next_id, slot });
+        next_id = next_id + 1U;
+    }
+
+    void pop()
+    {
+        if ( live.items.empty() )
+            return;
+        live.items.pop_front();
+        live.tail = (live.tail + 1U) % QUEUE_SIZE;
+    }
+
+    void commit(t_journal_sync sync, uint32_t interval)
+    {
+        commits_since_sync = commits_since_sync + 1U;
+        if ( (sync == JOURNAL_SYNC_BATCH) ||
+             ((sync == JOURNAL_SYNC_PERIODIC) &&
+              (commits_since_sync >= interval)) )
+            flush();
+        else
+            committed = live;
+    }
+
+    void flush()
+    {
+        committed = live;
+        synced = live;
+        commits_since_sync = 0U;
+    }
+
+    /**
+     * @brief The reopened Queue is recovered from the live record without
+     * flushes, and from the synced one otherwise.
+     */
+    void reopen(t_journal_sync sync)
+    {
+        if ( sync == JOURNAL_SYNC_NONE )
+            live = committed;
+        else
+        {
+            live = synced;
+            committed = synced;
+        }
+        commits_since_sync = 0U;
+    }
+
+    static void overwrite(t_state& state, uint32_t slot)
+    {
+        if ( !state.items.empty() && (state.tail == slot) )
+        {
+            state.items.pop_front();
+            state.tail = (state.tail + 1U) % QUEUE_SIZE;
+        }
+    }
+};
+
+/**
+ * @brief Simulate a process crash: close without committing and reopen,
+ * checking the recovered elements.
+ */
+static void crash(t_journal& queue, t_model& model, const char* path,
+        t_journal_sync sync, uint32_t interval)
+{
+    queue.close();
+    STEST_CHECK(queue.open(path, sync, interval));
+    model.reopen(sync);
+    check_contents(queue, model.live.items);
+
+    // The check pops are not committed, so reopening restores them
+    queue.close();
+    STEST_CHECK(queue.open(path, sync, interval));
+    STEST_CHECK(queue.size() == model.live.items.size());
+}
+
+/*****************************************************************************/
+
+/* Tests */
+
+static void test_none_recovers_last_commit()
+{
+    t_journal queue;
+    t_model model;
+    char path[64];
+
+    queue_path(path, sizeof(path), "journal_none");
+    unlink(path);
+    STEST_CHECK(queue.open(path, JOURNAL_SYNC_NONE));
+
+    for ( uint32_t i = 0U; i < 5U; i++ )
+    {
+        queue.push(make_entry(model.next_id));
+        model.push();
+    }
+    queue.commit();
+    model.commit(JOURNAL_SYNC_NONE, 1U);
+    queue.push(make_entry(model.next_id));
+    model.push();
+    queue.pop();
+    model.pop();
+
+    crash(queue, model, path, JOURNAL_SYNC_NONE, 1U);
+    STEST_CHECK(queue.size() == 5U);
+    STEST_CHECK(queue.front()->id == 1U);
+
+    queue.close();
+    unlink(path);
+}
+
+static void test_periodic_recovers_last_flush()
+{
+    static const uint32_t INTERVAL = 4U;
+    t_journal queue;
+    t_model model;
+    char path[64];
+
+    queue_path(path, sizeof(path), "journal_periodic");
+    unlink(path);
+    STEST_CHECK(queue.open(path, JOURNAL_SYNC_PERIODIC, INTERVAL));
+
+    // Commits that are not flushed are lost
+    for ( uint32_t i = 0U; i < (INTERVAL - 1U); i++ )
+    {
+        queue.push(make_entry(model.next_id));
+        model.push();
+        queue.commit();
+        model.commit(JOURNAL_SYNC_PERIODIC, INTERVAL);
+    }
+    crash(queue, model, path, JOURNAL_SYNC_PERIODIC, INTERVAL);
+    STEST_CHECK(queue.empty());
+
+    // The commit that completes the interval is flushed
+    for ( uint32_t i = 0U; i < INTERVAL; i++ )
+    {
+        queue.push(make_entry(model.next_id));
+        model.push();
+        queue.commit();
+        model.commit(JOURNAL_SYNC_PERIODIC, INTERVAL);
+    }
+    crash(queue, model, path, JOURNAL_SYNC_PERIODIC, INTERVAL);
+    STEST_CHECK(queue.size() == INTERVAL);
+
+    // An explicit sync is flushed at any time
+    queue.pop();
+    model.pop();
+    queue.sync();
+    model.flush();
+    crash(queue, model, path, JOURNAL_SYNC_PERIODIC, INTERVAL);
+    STEST_CHECK(queue.size() == (INTERVAL - 1U));
+
+    queue.close();
+    unlink(path);
+}
+
+static void test_batch_recovers_every_commit()
+{
+    t_journal queue;
+    t_model model;
+    char path[64];
+
+    queue_path(path, sizeof(path), "journal_batch");
+    unlink(path);
+    STEST_CHECK(queue.open(path, JOURNAL_SYNC_BATCH));
+
+    for ( uint32_t i = 0U; i < 3U; i++ )
+    {
+        queue.push(make_entry(model.next_id));
+        model.push();
+        queue.commit();
+        model.commit(JOURNAL_SYNC_BATCH, 1U);
+    }
+    queue.push(make_entry(model.next_id));
+    model.push();
+    crash(queue, model, path, JOURNAL_SYNC_BATCH, 1U);
+    STEST_CHECK(queue.size() == 3U);
+
+    queue.close();
+    unlink(path);
+}
+
+/**
+ * @brief Random operations with crashes, including pushes that overwrite
+ * committed and synced elements before the next commit.
+ */
+static void test_random_recovery(t_journal_sync sync, uint32_t seed)
+{
+    static const uint32_t INTERVAL = 3U;
+    t_journal queue;
+    t_model model;
+    std::mt19937 rng(seed);
+    char path[64];
+
+    queue_path(path, sizeof(path), "journal_random");
+    unlink(path);
+    STEST_CHECK(queue.open(path, sync, INTERVAL));
+
+    for ( uint32_t step = 0U; step < 3000U; step++ )
+    {
+        uint32_t op = rng() % 100U;
+
+        if ( op < 50U )
+        {
+            STEST_CHECK(queue.push(make_entry(model.next_id)) ==
+                    (( model.live.items.size() == QUEUE_SIZE ) ?
+                     BUFFER_OVERFLOW : BUFFER_OK));
+            model.push();
+        }
+        else if ( op < 75U )
+        {
+            if ( !model.live.items.empty() )
+                STEST_CHECK(queue.front()->id == model.live.items.front().id);
+            queue.pop();
+            model.pop();
+        }
+        else if ( op < 93U )
+        {
+            queue.commit();
+            model.commit(sync, INTERVAL);
+        }
+        else if ( op < 95U )
+        {
+            queue.sync();
+            model.flush();
+        }
+        else
+            crash(queue, model, path, sync, INTERVAL);
+
+        STEST_CHECK(queue.size() == model.live.items.size());
+        if ( stest_failures != 0 )
+            break;
+    }
+
+    queue.close();
+    unlink(path);
+}
+
+/*****************************************************************************/
+
+/* Main Function */
+
+int main()
+{
+    test_none_recovers_last_commit();
+    test_periodic_recovers_last_flush();
+    test_batch_recovers_every_commit();
+    for ( uint32_t seed = 1U; seed <= 4U; seed++ )
+    {
+        test_random_recovery(JOURNAL_SYNC_NONE, seed);
+        test_random_recovery(JOURNAL_SYNC_PERIODIC, seed);
+        test_random_recovery(JOURNAL_SYNC_BATCH, seed);
+    }
+
+    return STEST_RESULT("test_journalqueue");
+}
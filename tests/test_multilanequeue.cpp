@@ -0,0 +1,184 @@
+/**
+ * @file    test_multilanequeue.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    17-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * SMultiLaneQueue tests against one std::deque per lane: random pushes
+ * (with overwrites of full lanes) and pops, checking the served lane and
+ * element, the lane sizes and the per lane overflow_count() against the
+ * number of overwrites of each lane, for a few lanes of different sizes
+ * and for the maximum of 32 lanes.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2022 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ libraries
+#include <cstdint>
+#include <deque>
+#include <random>
+
+// Multiple lanes priority Queue
+#include "smultilanequeue.hpp"
+
+// Test checks
+#include "stest.hpp"
+
+/*****************************************************************************/
+
+/* Test Helpers */
+
+/**
+ * @brief Random pushes and pops compared with one std::deque per lane.
+ */
+template <typename T_QUEUE, uint32_t NUM_LANES>
+static void run_against_model(T_QUEUE& queue, const uint32_t* sizes,
+        uint32_t seed)
+{
+    std::deque<uint32_t> model[NUM_LANES];
+    uint32_t overwrites[NUM_LANES] = { 0U };
+    std::mt19937 rng(seed);
+    uint32_t next = 0U;
+
+    queue.clear();
+    for ( uint32_t step = 0U; step < 50000U; step++ )
+    {
+        uint32_t top = NUM_LANES;
+        uint64_t total = 0U;
+
+        if ( (rng() % 100U) < 55U )
+        {
+            // Low priority lanes get more elements
+            uint32_t lane = rng() % NUM_LANES;
+            bool full;
+
+            if ( (rng() % 2U) == 0U )
+                lane = NUM_LANES - 1U - (lane % 2U);
+            full = ( model[lane].size() == sizes[lane] );
+            STEST_CHECK(queue.push(lane, next) ==
+                    ( full ? BUFFER_OVERFLOW : BUFFER_OK ));
+            if ( full )
+            {
+                model[lane].pop_front();
+                overwrites[lane] = overwrites[lane] + 1U;
+            }
+            model[lane].push_back(next);
+            next = next + 1U;
+        }
+        else
+        {
+            for ( uint32_t lane = 0U; lane < NUM_LANES; lane++ )
+            {
+                if ( !model[lane].empty() )
+                {
+                    model[lane].pop_front();
+                    break;
+                }
+            }
+            queue.pop();
+        }
+
+        for ( uint32_t lane = 0U; lane < NUM_LANES; lane++ )
+        {
+            STEST_CHECK(queue.lane(lane)->size() == model[lane].size());
+            STEST_CHECK(queue.overflow_count(lane) == overwrites[lane]);
+            if ( (top == NUM_LANES) && !model[lane].empty() )
+                top = lane;
+            total = total + model[lane].size();
+        }
+        STEST_CHECK(queue.top_lane() == top);
+        STEST_CHECK(queue.size() == total);
+        STEST_CHECK(queue.empty() == (total == 0U));
+        STEST_CHECK((queue.front() == nullptr) == (top == NUM_LANES));
+        if ( (top < NUM_LANES) && (queue.front() != nullptr) )
+            STEST_CHECK(*(queue.front()) == model[top].front());
+        if ( stest_failures != 0 )
+            return;
+    }
+}
+
+/*****************************************************************************/
+
+/* Tests */
+
+static void test_lanes_of_different_sizes()
+{
+    typedef SMultiLaneQueue<uint32_t, 4, 1, 8, 2> t_queue;
+    static t_queue queue;
+    static const uint32_t sizes[] = { 4U, 1U, 8U, 2U };
+
+    for ( uint32_t seed = 1U; seed <= 3U; seed++ )
+        run_against_model<t_queue, 4>(queue, sizes, seed);
+}
+
+static void test_all_lanes()
+{
+    typedef SMultiLaneQueue<uint32_t, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 4, 8>
+            t_queue;
+    static t_queue queue;
+    uint32_t sizes[32];
+
+    for ( uint32_t lane = 0U; lane < 32U; lane++ )
+        sizes[lane] = ( lane < 30U ) ? 2U : ( (lane == 30U) ? 4U : 8U );
+    run_against_model<t_queue, 32>(queue, sizes, 48U);
+}
+
+/**
+ * @brief Pushes to a lane out of range are discarded without counting an
+ * overflow, and clear() resets the counters.
+ */
+static void test_out_of_range_and_clear()
+{
+    static SMultiLaneQueue<uint32_t, 2, 2> queue;
+
+    STEST_CHECK(queue.push(2U, 1U) == BUFFER_OVERFLOW);
+    STEST_CHECK(queue.empty());
+    STEST_CHECK(queue.overflow_count(0U) == 0U);
+    STEST_CHECK(queue.overflow_count(1U) == 0U);
+    STEST_CHECK(queue.overflow_count(2U) == 0U);
+    STEST_CHECK(queue.lane(2U) == nullptr);
+
+    for ( uint32_t i = 0U; i < 5U; i++ )
+        queue.push(1U, i);
+    STEST_CHECK(queue.overflow_count(1U) == 3U);
+    STEST_CHECK(*(queue.front()) == 3U);
+    queue.clear();
+    STEST_CHECK(queue.overflow_count(1U) == 0U);
+    STEST_CHECK(queue.top_lane() == 2U);
+}
+
+/*****************************************************************************/
+
+/* Main Function */
+
+int main()
+{
+    test_lanes_of_different_sizes();
+    test_all_lanes();
+    test_out_of_range_and_clear();
+
+    return STEST_RESULT("test_multilanequeue");
+}
@@ -0,0 +1,202 @@
+/**
+ * @file    test_numkernels.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    17-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * SNumQueue kernels tests: the SSE and AVX2 sum, min, max and dot kernels
+ * of float and int32_t are called directly and compared with the scalar
+ * ones, for every length from 0 to 40 elements and every start alignment
+ * within 32 bytes. The kernels that the running CPU does not support are
+ * skipped.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2022 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ libraries
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <random>
+
+// Numeric Queue
+#include "snumqueue.hpp"
+
+// Test checks
+#include "stest.hpp"
+
+/*****************************************************************************/
+
+/* Test Constants */
+
+static const size_t MAX_LENGTH = 40U;
+
+/**
+ * @brief Number of start offsets (elements) to cover every alignment of
+ * an AVX2 load.
+ */
+static const size_t NUM_OFFSETS = 8U;
+
+/*****************************************************************************/
+
+/* Test Helpers */
+
+/**
+ * @brief Compare a set of SIMD kernels with the scalar ones.
+ *
+ * @details
+ * The float values are small integers, so the sums and dot products are
+ * exact whatever the order of the additions. The int32_t values of a use
+ * the whole range (including the minimum and the maximum) and the ones of b
+ * are smaller, so the dot products do not overflow.
+ */
+template <typename T_ELEMENT, typename T_KERNEL_SUM, typename T_KERNEL,
+        typename T_KERNEL_DOT>
+static void check_kernels(const char* name, T_KERNEL_SUM sum, T_KERNEL min,
+        T_KERNEL max, T_KERNEL_DOT dot)
+{
+    typedef SNumKernels<T_ELEMENT> t_kernels;
+    static T_ELEMENT a[MAX_LENGTH + NUM_OFFSETS];
+    static T_ELEMENT b[MAX_LENGTH + NUM_OFFSETS];
+    std::mt19937 rng(7U);
+
+    for ( size_t i = 0U; i < (MAX_LENGTH + NUM_OFFSETS); i++ )
+    {
+        if ( std::numeric_limits<T_ELEMENT>::is_integer )
+        {
+            a[i] = static_cast<T_ELEMENT>(static_cast<int32_t>(rng()));
+            b[i] = static_cast<T_ELEMENT>(static_cast<int32_t>(rng() %
+                    0x2000000U) - 0x1000000);
+        }
+        else
+        {
+            a[i] = static_cast<T_ELEMENT>(static_cast<int32_t>(rng() % 201U)
+                    - 100);
+            b[i] = static_cast<T_ELEMENT>(static_cast<int32_t>(rng() % 21U)
+                    - 10);
+        }
+    }
+    if ( std::numeric_limits<T_ELEMENT>::is_integer )
+    {
+        a[3] = std::numeric_limits<T_ELEMENT>::min();
+        a[21] = std::numeric_limits<T_ELEMENT>::max();
+    }
+
+    for ( size_t offset = 0U; offset < NUM_OFFSETS; offset++ )
+    {
+        const T_ELEMENT* pa = a + offset;
+        const T_ELEMENT* pb = b + offset;
+
+        for ( size_t n = 0U; n <= MAX_LENGTH; n++ )
+        {
+            bool ok = ( sum(pa, n) == t_kernels::sum_scalar(pa, n) ) &&
+                      ( dot(pa, pb, n) == t_kernels::dot_scalar(pa, pb, n) );
+
+            // min() and max() are not defined for empty arrays
+            if ( n > 0U )
+            {
+                ok = ok && ( min(pa, n) == t_kernels::min_scalar(pa, n) ) &&
+                     ( max(pa, n) == t_kernels::max_scalar(pa, n) );
+            }
+            if ( !ok )
+            {
+                std::printf("%s: mismatch at offset %zu, length %zu\n", name,
+                        offset, n);
+                stest_failures = stest_failures + 1;
+                return;
+            }
+        }
+    }
+}
+
+/*****************************************************************************/
+
+/* Tests */
+
+#if defined(SQUEUE_SIMD_X86)
+
+static void test_float_kernels()
+{
+    typedef SNumKernels<float> t_kernels;
+
+    if ( __builtin_cpu_supports("sse2") )
+    {
+        check_kernels<float>("float sse", t_kernels::sum_sse,
+                t_kernels::min_sse, t_kernels::max_sse, t_kernels::dot_sse);
+    }
+    if ( __builtin_cpu_supports("avx2") )
+    {
+        check_kernels<float>("float avx2", t_kernels::sum_avx2,
+                t_kernels::min_avx2, t_kernels::max_avx2,
+                t_kernels::dot_avx2);
+    }
+}
+
+static void test_int32_kernels()
+{
+    typedef SNumKernels<int32_t> t_kernels;
+
+    if ( __builtin_cpu_supports("sse4.1") )
+    {
+        check_kernels<int32_t>("int32 sse", t_kernels::sum_sse,
+                t_kernels::min_sse, t_kernels::max_sse, t_kernels::dot_sse);
+    }
+    if ( __builtin_cpu_supports("avx2") )
+    {
+        check_kernels<int32_t>("int32 avx2", t_kernels::sum_avx2,
+                t_kernels::min_avx2, t_kernels::max_avx2,
+                t_kernels::dot_avx2);
+    }
+}
+
+#endif
+
+/**
+ * @brief The kernels selected for the running CPU.
+ */
+static void test_selected_kernels()
+{
+    const SNumKernels<float>::t_table& f = SNumKernels<float>::table();
+    const SNumKernels<int32_t>::t_table& i = SNumKernels<int32_t>::table();
+
+    check_kernels<float>("float selected", f.sum, f.min, f.max, f.dot);
+    check_kernels<int32_t>("int32 selected", i.sum, i.min, i.max, i.dot);
+}
+
+/*****************************************************************************/
+
+/* Main Function */
+
+int main()
+{
+#if defined(SQUEUE_SIMD_X86)
+    __builtin_cpu_init();
+    test_float_kernels();
+    test_int32_kernels();
+#endif
+    test_selected_kernels();
+
+    return STEST_RESULT("test_numkernels");
+}
@@ -0,0 +1,272 @@
+/**
+ * @file    test_objectpool.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    17-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Object pool tests: exhaustion and reuse of SObjectPool and
+ * SAtomicObjectPool objects, handle and range checks, and SPooledQueue and
+ * SPooledMpscQueue (from a single thread) against a std::deque, with
+ * elements that are acquired and then pushed, discarded or kept for a
+ * while, so the pool gets exhausted by elements that are not in the Queue.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2022 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ libraries
+#include <cstdint>
+#include <deque>
+#include <random>
+#include <vector>
+
+// Object pools
+#include "sobjectpool.hpp"
+
+// Test checks
+#include "stest.hpp"
+
+/*****************************************************************************/
+
+/* Test Data Types */
+
+struct t_message
+{
+    uint32_t id;
+    uint8_t payload[60];
+};
+
+static const uint32_t POOL_SIZE = 8U;
+
+/*****************************************************************************/
+
+/* Test Helpers */
+
+/**
+ * @brief Check the Queue counters: size() of a SPooledQueue, and
+ * available() of a SPooledMpscQueue (that has no size()).
+ */
+template <uint32_t QUEUE_SIZE>
+static bool counts_are(const SPooledQueue<t_message, QUEUE_SIZE>& queue,
+        size_t queued, size_t)
+{
+    return ( queue.size() == queued );
+}
+
+template <uint32_t QUEUE_SIZE>
+static bool counts_are(const SPooledMpscQueue<t_message, QUEUE_SIZE>& queue,
+        size_t queued, size_t held)
+{
+    return ( queue.available() == (QUEUE_SIZE - queued - held) );
+}
+
+/**
+ * @brief Random acquires, pushes, discards and pops compared with a
+ * std::deque of ids. The acquired elements that are not pushed yet are
+ * kept in a list, so the pool can be exhausted while the Queue is not full.
+ */
+template <typename T_QUEUE>
+static void run_against_model(T_QUEUE& queue, uint32_t seed)
+{
+    std::vector<t_message*> held;
+    std::deque<uint32_t> model;
+    std::mt19937 rng(seed);
+    uint32_t next_id = 0U;
+
+    for ( uint32_t step = 0U; step < 100000U; step++ )
+    {
+        uint32_t op = rng() % 100U;
+
+        if ( op < 35U )
+        {
+            t_message* element = queue.acquire();
+
+            STEST_CHECK((element == nullptr) ==
+                    ((held.size() + model.size()) == POOL_SIZE));
+            if ( element != nullptr )
+            {
+                element->id = next_id;
+                next_id = next_id + 1U;
+                held.push_back(element);
+            }
+        }
+        else if ( (op < 70U) && !held.empty() )
+        {
+            size_t i = rng() % held.size();
+
+            STEST_CHECK(queue.push(held[i]));
+            model.push_back(held[i]->id);
+            held.erase(held.begin() + static_cast<std::ptrdiff_t>(i));
+        }
+        else if ( (op < 80U) && !held.empty() )
+        {
+            size_t i = rng() % held.size();
+
+            queue.discard(held[i]);
+            held.erase(held.begin() + static_cast<std::ptrdiff_t>(i));
+        }
+        else
+        {
+            queue.pop();
+            if ( !model.empty() )
+                model.pop_front();
+        }
+
+        STEST_CHECK(counts_are(queue, model.size(), held.size()));
+        STEST_CHECK(queue.empty() == model.empty());
+        STEST_CHECK((queue.front() == nullptr) == model.empty());
+        if ( !model.empty() && (queue.front() != nullptr) )
+            STEST_CHECK(queue.front()->id == model.front());
+        if ( stest_failures != 0 )
+            return;
+    }
+}
+
+/*****************************************************************************/
+
+/* Tests */
+
+static void test_pool_exhaustion()
+{
+    static SObjectPool<t_message, POOL_SIZE> pool;
+    static t_message foreign;
+    t_pool_handle handles[POOL_SIZE];
+    bool used[POOL_SIZE] = { false };
+
+    for ( uint32_t i = 0U; i < POOL_SIZE; i++ )
+    {
+        handles[i] = pool.acquire();
+        STEST_CHECK((handles[i] < POOL_SIZE) && !used[handles[i] % POOL_SIZE]);
+        used[handles[i] % POOL_SIZE] = true;
+        STEST_CHECK(pool.handle(pool.get(handles[i])) == handles[i]);
+    }
+    STEST_CHECK(pool.available() == 0U);
+    STEST_CHECK(pool.acquire() == SPOOL_INVALID_HANDLE);
+
+    // Out of range handles and objects
+    STEST_CHECK(pool.get(POOL_SIZE) == nullptr);
+    STEST_CHECK(pool.get(SPOOL_INVALID_HANDLE) == nullptr);
+    STEST_CHECK(!pool.release(POOL_SIZE));
+    STEST_CHECK(pool.handle(&foreign) == SPOOL_INVALID_HANDLE);
+    STEST_CHECK(pool.available() == 0U);
+
+    // A released object is the next one acquired
+    STEST_CHECK(pool.release(handles[3]));
+    STEST_CHECK(pool.available() == 1U);
+    STEST_CHECK(pool.acquire() == handles[3]);
+    STEST_CHECK(pool.acquire() == SPOOL_INVALID_HANDLE);
+
+    pool.clear();
+    STEST_CHECK(pool.available() == POOL_SIZE);
+}
+
+static void test_atomic_pool_exhaustion()
+{
+    static SAtomicObjectPool<t_message, POOL_SIZE> pool;
+    static t_message foreign;
+    t_pool_handle handles[POOL_SIZE];
+
+    for ( uint32_t i = 0U; i < POOL_SIZE; i++ )
+    {
+        handles[i] = pool.acquire();
+        STEST_CHECK(pool.available() == (POOL_SIZE - i - 1U));
+        STEST_CHECK(pool.handle(pool.get(handles[i])) == handles[i]);
+    }
+    STEST_CHECK(pool.acquire() == SPOOL_INVALID_HANDLE);
+    STEST_CHECK(pool.handle(&foreign) == SPOOL_INVALID_HANDLE);
+    STEST_CHECK(!pool.release(POOL_SIZE));
+    STEST_CHECK(pool.available() == 0U);
+
+    STEST_CHECK(pool.release(handles[5]));
+    STEST_CHECK(pool.available() == 1U);
+    STEST_CHECK(pool.acquire() == handles[5]);
+    for ( uint32_t i = 0U; i < POOL_SIZE; i++ )
+        STEST_CHECK(pool.release(handles[i]));
+    STEST_CHECK(pool.available() == POOL_SIZE);
+}
+
+static void test_pooled_queue_discard()
+{
+    static SPooledQueue<t_message, POOL_SIZE> queue;
+    static t_message foreign;
+    t_message* elements[POOL_SIZE];
+
+    for ( uint32_t i = 0U; i < POOL_SIZE; i++ )
+    {
+        elements[i] = queue.acquire();
+        STEST_CHECK(elements[i] != nullptr);
+        if ( elements[i] == nullptr )
+            return;
+        elements[i]->id = i;
+    }
+    STEST_CHECK(queue.acquire() == nullptr);
+    STEST_CHECK(!queue.push(&foreign));
+
+    // Discarded elements go back to the pool, not to the Queue
+    STEST_CHECK(queue.push(elements[0]));
+    queue.discard(elements[1]);
+    queue.discard(elements[2]);
+    STEST_CHECK(queue.size() == 1U);
+    STEST_CHECK(queue.acquire() != nullptr);
+    STEST_CHECK(queue.acquire() != nullptr);
+    STEST_CHECK(queue.acquire() == nullptr);
+
+    // A pop returns the element to the pool
+    STEST_CHECK(queue.front() == elements[0]);
+    queue.pop();
+    STEST_CHECK(queue.empty());
+    STEST_CHECK(queue.front() == nullptr);
+    STEST_CHECK(queue.acquire() == elements[0]);
+}
+
+static void test_pooled_queue_against_model()
+{
+    static SPooledQueue<t_message, POOL_SIZE> queue;
+
+    run_against_model(queue, 45U);
+}
+
+static void test_pooled_mpsc_queue_against_model()
+{
+    static SPooledMpscQueue<t_message, POOL_SIZE> queue;
+    static t_message foreign;
+
+    STEST_CHECK(!queue.push(&foreign));
+    run_against_model(queue, 46U);
+}
+
+/*****************************************************************************/
+
+/* Main Function */
+
+int main()
+{
+    test_pool_exhaustion();
+    test_atomic_pool_exhaustion();
+    test_pooled_queue_discard();
+    test_pooled_queue_against_model();
+    test_pooled_mpsc_queue_against_model();
+
+    return STEST_RESULT("test_objectpool");
+}
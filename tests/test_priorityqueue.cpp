@@ -0,0 +1,161 @@
+/**
+ * @file    test_priorityqueue.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    17-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * SPriorityQueue tests against a std::multiset: random pushes and pops for
+ * heap arities 2, 3, 4, 5 and 8, capacities from 1 element, both overflow
+ * policies (DROP_LOWEST replaces the lowest priority element only when the
+ * new one has a higher priority, REJECT always discards the new one), and
+ * a reversed compare function.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2022 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ libraries
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <set>
+
+// Priority Queue
+#include "spriorityqueue.hpp"
+
+// Test checks
+#include "stest.hpp"
+
+/*****************************************************************************/
+
+/* Test Helpers */
+
+/**
+ * @brief Random pushes and pops compared with a std::multiset ordered with
+ * the same compare function (its last element is the highest priority one).
+ */
+template <uint32_t QUEUE_SIZE, t_priority_overflow OVERFLOW_POLICY,
+        uint32_t HEAP_ARITY, typename T_COMPARE = std::less<int32_t>>
+static void run_against_model(uint32_t seed, uint32_t num_distinct)
+{
+    static SPriorityQueue<int32_t, QUEUE_SIZE, T_COMPARE, OVERFLOW_POLICY,
+            HEAP_ARITY> queue;
+    std::multiset<int32_t, T_COMPARE> model;
+    std::mt19937 rng(seed);
+
+    queue.clear();
+    for ( uint32_t step = 0U; step < 20000U; step++ )
+    {
+        if ( (rng() % 100U) < 60U )
+        {
+            int32_t value = static_cast<int32_t>(rng() % num_distinct);
+            bool full = ( model.size() == QUEUE_SIZE );
+
+            STEST_CHECK(queue.push(value) ==
+                    ( full ? BUFFER_OVERFLOW : BUFFER_OK ));
+            if ( !full )
+                model.insert(value);
+            else if ( (OVERFLOW_POLICY == PRIORITY_DROP_LOWEST) &&
+                      T_COMPARE()(*(model.begin()), value) )
+            {
+                model.erase(model.begin());
+                model.insert(value);
+            }
+        }
+        else
+        {
+            queue.pop();
+            if ( !model.empty() )
+                model.erase(std::prev(model.end()));
+        }
+
+        STEST_CHECK(queue.size() == model.size());
+        STEST_CHECK(queue.empty() == model.empty());
+        STEST_CHECK((queue.top() == nullptr) == model.empty());
+        if ( !model.empty() && (queue.top() != nullptr) )
+            STEST_CHECK(*(queue.top()) == *(model.rbegin()));
+        if ( stest_failures != 0 )
+            return;
+    }
+
+    // The elements come out in priority order
+    while ( !model.empty() && (queue.top() != nullptr) )
+    {
+        STEST_CHECK(*(queue.top()) == *(model.rbegin()));
+        queue.pop();
+        model.erase(std::prev(model.end()));
+    }
+    STEST_CHECK(queue.empty() && model.empty());
+}
+
+/*****************************************************************************/
+
+/* Tests */
+
+static void test_capacity_one()
+{
+    SPriorityQueue<int32_t, 1> drop;
+    SPriorityQueue<int32_t, 1, std::less<int32_t>, PRIORITY_REJECT> reject;
+
+    STEST_CHECK(drop.push(5) == BUFFER_OK);
+    STEST_CHECK(drop.push(3) == BUFFER_OVERFLOW);
+    STEST_CHECK(*(drop.top()) == 5);
+    STEST_CHECK(drop.push(5) == BUFFER_OVERFLOW);
+    STEST_CHECK(drop.push(9) == BUFFER_OVERFLOW);
+    STEST_CHECK(*(drop.top()) == 9);
+    STEST_CHECK(drop.size() == 1U);
+    drop.pop();
+    STEST_CHECK(drop.top() == nullptr);
+
+    STEST_CHECK(reject.push(5) == BUFFER_OK);
+    STEST_CHECK(reject.push(9) == BUFFER_OVERFLOW);
+    STEST_CHECK(*(reject.top()) == 5);
+    STEST_CHECK(reject.size() == 1U);
+}
+
+/*****************************************************************************/
+
+/* Main Function */
+
+int main()
+{
+    test_capacity_one();
+    for ( uint32_t seed = 1U; seed <= 3U; seed++ )
+    {
+        run_against_model<1, PRIORITY_DROP_LOWEST, 4>(seed, 10U);
+        run_against_model<1, PRIORITY_REJECT, 3>(seed, 10U);
+        run_against_model<7, PRIORITY_DROP_LOWEST, 2>(seed, 5U);
+        run_against_model<7, PRIORITY_REJECT, 2>(seed, 5U);
+        run_against_model<20, PRIORITY_DROP_LOWEST, 3>(seed, 30U);
+        run_against_model<20, PRIORITY_REJECT, 3>(seed, 30U);
+        run_against_model<64, PRIORITY_DROP_LOWEST, 4>(seed, 1000U);
+        run_against_model<64, PRIORITY_REJECT, 5>(seed, 8U);
+        run_against_model<100, PRIORITY_DROP_LOWEST, 8>(seed, 50U);
+        run_against_model<33, PRIORITY_DROP_LOWEST, 5,
+                std::greater<int32_t>>(seed, 40U);
+    }
+
+    return STEST_RESULT("test_priorityqueue");
+}
@@ -0,0 +1,263 @@
+
+/**
+ * @file    test_queuemerger.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    17-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * SQueueMerger tests: a Queue refilled after being emptied is merged in
+ * order once notified or refilled, external changes are taken with
+ * notify(), and a random sequence of pushes (notified one by one or taken
+ * by refill()) and merged pops is checked against a linear scan of all the
+ * Queues fronts.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2022 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ libraries
+#include <cstdint>
+#include <random>
+
+// Queue merger
+#include "squeuemerger.hpp"
+
+// Test checks
+#include "stest.hpp"
+
+/*****************************************************************************/
+
+/* Test Data Types */
+
+/**
+ * @brief Merged element.
+ */
+struct t_event
+{
+    uint64_t timestamp;
+    uint32_t feed;
+};
+
+/**
+ * @brief Key extractor of the merged elements.
+ */
+struct t_event_key
+{
+    uint64_t operator()(const t_event& event) const
+    {
+        return event.timestamp;
+    }
+};
+
+typedef SQueue<t_event, 64> t_feed;
+
+/*****************************************************************************/
+
+/* Test Helpers */
+
+/**
+ * @brief Get the Queue with the lowest front key (lowest Queue number on
+ * ties) with a linear scan.
+ */
+static uint32_t scan_top(t_feed* const* feeds, uint32_t k)
+{
+    uint32_t top = k;
+
+    for ( uint32_t i = 0U; i < k; i++ )
+    {
+        if ( feeds[i]->empty() )
+            continue;
+        if ( (top == k) ||
+             (feeds[i]->front()->timestamp < feeds[top]->front()->timestamp) )
+            top = i;
+    }
+
+    return top;
+}
+
+/*****************************************************************************/
+
+/* Tests */
+
+static void test_refilled_queue()
+{
+    t_feed feeds[4];
+    t_feed* sources[4] = { &feeds[0], &feeds[1], &feeds[2], &feeds[3] };
+
+    feeds[0].push(t_event{ 0U, 0U });
+    for ( uint32_t f = 1U; f < 4U; f++ )
+    {
+        for ( uint64_t t = 0U; t < 3U; t++ )
+            feeds[f].push(t_event{ (100U * f) + t, f });
+    }
+
+    SQueueMerger<t_feed, 4, t_event_key> merger(sources);
+
+    STEST_CHECK(merger.front()->timestamp == 0U);
+    merger.pop();
+
+    // Feed 0 is empty and gets a new element before the others
+    feeds[0].push(t_event{ 1U, 0U });
+    STEST_CHECK(merger.front()->timestamp == 100U);
+    STEST_CHECK(merger.notify(0U));
+    STEST_CHECK(merger.front()->timestamp == 1U);
+    merger.pop();
+    STEST_CHECK(merger.front()->timestamp == 100U);
+    merger.pop();
+    STEST_CHECK(merger.front()->timestamp == 101U);
+
+    // Feeds 0 and 1 get elements, refill() takes both without notify()
+    feeds[0].push(t_event{ 2U, 0U });
+    merger.pop();
+    merger.pop();
+    feeds[1].push(t_event{ 3U, 1U });
+    merger.refill();
+    STEST_CHECK(merger.front()->timestamp == 2U);
+    merger.pop();
+    STEST_CHECK(merger.front()->timestamp == 3U);
+    merger.pop();
+    STEST_CHECK(merger.front()->timestamp == 200U);
+}
+
+static void test_all_empty()
+{
+    t_feed feeds[3];
+    t_feed* sources[3] = { &feeds[0], &feeds[1], &feeds[2] };
+    SQueueMerger<t_feed, 3, t_event_key> merger(sources);
+
+    STEST_CHECK(merger.front() == nullptr);
+    STEST_CHECK(merger.top_queue() == 3U);
+    merger.pop();
+
+    feeds[2].push(t_event{ 7U, 2U });
+    STEST_CHECK(merger.top_queue() == 3U);
+    merger.refill();
+    STEST_CHECK(merger.top_queue() == 2U);
+    merger.pop();
+    STEST_CHECK(merger.front() == nullptr);
+}
+
+static void test_notify()
+{
+    t_feed feeds[2];
+    t_feed* sources[2] = { &feeds[0], &feeds[1] };
+
+    feeds[0].push(t_event{ 10U, 0U });
+    feeds[0].push(t_event{ 30U, 0U });
+    feeds[1].push(t_event{ 20U, 1U });
+
+    SQueueMerger<t_feed, 2, t_event_key> merger(sources);
+
+    STEST_CHECK(merger.top_queue() == 0U);
+
+    // External pop of the winner Queue front
+    feeds[0].pop();
+    STEST_CHECK(merger.notify(0U));
+    STEST_CHECK(merger.front()->timestamp == 20U);
+
+    // External pop that empties a Queue
+    feeds[1].pop();
+    STEST_CHECK(merger.notify(1U));
+    STEST_CHECK(merger.front()->timestamp == 30U);
+    STEST_CHECK(!merger.notify(2U));
+}
+
+template <uint32_t K>
+static void test_random_against_scan(uint32_t seed)
+{
+    t_feed feeds[K];
+    t_feed* sources[K];
+    uint64_t clock[K];
+    bool refill = false;
+    std::mt19937 rng(seed);
+
+    for ( uint32_t i = 0U; i < K; i++ )
+    {
+        sources[i] = &(feeds[i]);
+        clock[i] = 0U;
+    }
+
+    SQueueMerger<t_feed, K, t_event_key> merger(sources);
+
+    for ( uint32_t step = 0U; step < 20000U; step++ )
+    {
+        // Feeds get elements at different rates, some of them stay empty
+        if ( (rng() % 2U) == 0U )
+        {
+            uint32_t f = rng() % K;
+
+            if ( (f % 4U) != 3U )
+                f = rng() % ((K + 1U) / 2U);
+            if ( feeds[f].size() < feeds[f].capacity() )
+            {
+                bool was_empty = feeds[f].empty();
+
+                clock[f] = clock[f] + (rng() % 8U);
+                feeds[f].push(t_event{ clock[f], f });
+
+                // A refilled Queue is notified now or taken by refill()
+                if ( was_empty && ((rng() % 2U) == 0U) )
+                    merger.notify(f);
+                else if ( was_empty )
+                    refill = true;
+            }
+        }
+        else
+        {
+            uint32_t expected = scan_top(sources, K);
+
+            if ( refill )
+                merger.refill();
+            refill = false;
+
+            STEST_CHECK(merger.top_queue() == expected);
+            if ( merger.top_queue() != expected )
+                return;
+            merger.pop();
+        }
+    }
+}
+
+/*****************************************************************************/
+
+/* Main Function */
+
+int main()
+{
+    test_refilled_queue();
+    test_all_empty();
+    test_notify();
+    for ( uint32_t seed = 1U; seed <= 20U; seed++ )
+    {
+        test_random_against_scan<1>(seed);
+        test_random_against_scan<3>(seed);
+        test_random_against_scan<4>(seed);
+        test_random_against_scan<16>(seed);
+        test_random_against_scan<17>(seed);
+        test_random_against_scan<64>(seed);
+        test_random_against_scan<100>(seed);
+    }
+
+    return STEST_RESULT("test_queuemerger");
+}
@@ -0,0 +1,309 @@
+
+/**
+ * @file    test_shmqueue.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    17-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * SShmQueue push_stream() tests: the non-temporal stores are used in both
+ * concurrency modes for elements whose size is a multiple of 16 bytes, and
+ * the streamed elements reach the consumer in order and with their whole
+ * payload, with several producer threads (MPSC) and with one (SPSC). A
+ * Queue that is not attached (before create() or attach(), and after
+ * detach()) rejects every push and stays empty.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2022 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ libraries
+#include <cstdint>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+// POSIX libraries
+#include <unistd.h>
+
+// Shared memory Queue
+#include "sshmqueue.hpp"
+
+// Test checks
+#include "stest.hpp"
+
+/*****************************************************************************/
+
+/* Test Data Types */
+
+/**
+ * @brief Large element, written with streaming stores.
+ */
+struct t_message
+{
+    uint32_t producer;
+    uint32_t sequence;
+    uint8_t payload[56];
+};
+
+/**
+ * @brief Small element, its size is not a multiple of 16 bytes.
+ */
+struct t_small
+{
+    uint32_t values[3];
+};
+
+/*****************************************************************************/
+
+/* Test Helpers */
+
+/**
+ * @brief Get a backing file path unique to this test process.
+ */
+static void queue_path(char* path, size_t size, const char* name)
+{
+    std::snprintf(path, size, "/tmp/squeue_test_%s_%d", name,
+            static_cast<int>(getpid()));
+}
+
+/*****************************************************************************/
+
+/* Tests */
+
+static void test_stream_enabled()
+{
+    SShmQueue<t_message, 64, SHM_MPSC> mpsc;
+    SShmQueue<t_message, 64, SHM_SPSC> spsc;
+    SShmQueue<t_small, 64, SHM_MPSC> small;
+    char path[64];
+
+    STEST_CHECK(!mpsc.stream_enabled());
+
+    queue_path(path, sizeof(path), "mpsc");
+    STEST_CHECK(mpsc.create(path, SMEM_FILE));
+    queue_path(path, sizeof(path), "spsc");
+    STEST_CHECK(spsc.create(path, SMEM_FILE));
+    queue_path(path, sizeof(path), "small");
+    STEST_CHECK(small.create(path, SMEM_FILE));
+
+#if defined(SQUEUE_STREAM_X86)
+    STEST_CHECK(mpsc.stream_enabled());
+    STEST_CHECK(spsc.stream_enabled());
+#else
+    STEST_CHECK(!mpsc.stream_enabled());
+    STEST_CHECK(!spsc.stream_enabled());
+#endif
+    STEST_CHECK(!small.stream_enabled());
+
+    queue_path(path, sizeof(path), "mpsc");
+    SShmQueue<t_message, 64, SHM_MPSC>::remove(path, SMEM_FILE);
+    queue_path(path, sizeof(path), "spsc");
+    SShmQueue<t_message, 64, SHM_SPSC>::remove(path, SMEM_FILE);
+    queue_path(path, sizeof(path), "small");
+    SShmQueue<t_small, 64, SHM_MPSC>::remove(path, SMEM_FILE);
+}
+
+static void test_mpsc_stream_order()
+{
+    static const uint32_t PRODUCERS = 4U;
+    static const uint32_t MESSAGES = 20000U;
+    SShmQueue<t_message, 256, SHM_MPSC> queue;
+    std::vector<std::thread> producers;
+    uint32_t next[PRODUCERS] = { 0U };
+    uint32_t received = 0U;
+    bool in_order = true;
+    bool payload_ok = true;
+    char path[64];
+
+    queue_path(path, sizeof(path), "order");
+    STEST_CHECK(queue.create(path, SMEM_FILE));
+    if ( !queue.is_attached() )
+        return;
+
+    for ( uint32_t p = 0U; p < PRODUCERS; p++ )
+    {
+        producers.emplace_back(
+            [&queue, p]()
+            {
+                t_message message;
+
+                message.producer = p;
+                for ( uint32_t i = 0U; i < MESSAGES; i++ )
+                {
+                    message.sequence = i;
+                    for ( uint32_t b = 0U; b < sizeof(message.payload); b++ )
+                        message.payload[b] = static_cast<uint8_t>(i + b);
+                    while ( queue.push_stream(message) != BUFFER_OK )
+                        std::this_thread::yield();
+                }
+            });
+    }
+
+    while ( received < (PRODUCERS * MESSAGES) )
+    {
+        t_message* message = queue.front();
+
+        if ( message == nullptr )
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        if ( (message->producer >= PRODUCERS) ||
+             (message->sequence != next[message->producer]) )
+            in_order = false;
+        else
+            next[message->producer] = next[message->producer] + 1U;
+        for ( uint32_t b = 0U; b < sizeof(message->payload); b++ )
+        {
+            if ( message->payload[b] !=
+                 static_cast<uint8_t>(message->sequence + b) )
+                payload_ok = false;
+        }
+
+        queue.pop();
+        received = received + 1U;
+    }
+
+    for ( uint32_t p = 0U; p < PRODUCERS; p++ )
+        producers[p].join();
+
+    STEST_CHECK(in_order);
+    STEST_CHECK(payload_ok);
+    STEST_CHECK(queue.empty());
+
+    queue.detach();
+    SShmQueue<t_message, 256, SHM_MPSC>::remove(path, SMEM_FILE);
+}
+
+static void test_spsc_stream_payload()
+{
+    static const uint32_t MESSAGES = 20000U;
+    SShmQueue<t_message, 64, SHM_SPSC> queue;
+    uint32_t received = 0U;
+    bool in_order = true;
+    bool payload_ok = true;
+    char path[64];
+
+    queue_path(path, sizeof(path), "spsc_stream");
+    STEST_CHECK(queue.create(path, SMEM_FILE));
+    if ( !queue.is_attached() )
+        return;
+
+    std::thread producer(
+        [&queue]()
+        {
+            t_message message;
+
+            message.producer = 0U;
+            for ( uint32_t i = 0U; i < MESSAGES; i++ )
+            {
+                message.sequence = i;
+                for ( uint32_t b = 0U; b < sizeof(message.payload); b++ )
+                    message.payload[b] = static_cast<uint8_t>(i ^ b);
+                while ( queue.push_stream(message) != BUFFER_OK )
+                    std::this_thread::yield();
+            }
+        });
+
+    while ( received < MESSAGES )
+    {
+        t_message* message = queue.front();
+
+        if ( message == nullptr )
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        if ( message->sequence != received )
+            in_order = false;
+        for ( uint32_t b = 0U; b < sizeof(message->payload); b++ )
+        {
+            if ( message->payload[b] !=
+                 static_cast<uint8_t>(message->sequence ^ b) )
+                payload_ok = false;
+        }
+
+        queue.pop();
+        received = received + 1U;
+    }
+
+    producer.join();
+
+    STEST_CHECK(in_order);
+    STEST_CHECK(payload_ok);
+    STEST_CHECK(queue.empty());
+
+    queue.detach();
+    SShmQueue<t_message, 64, SHM_SPSC>::remove(path, SMEM_FILE);
+}
+
+/**
+ * @brief Check that a Queue that is not attached is empty and stays empty.
+ */
+template <typename T_QUEUE>
+static void check_not_attached(T_QUEUE& queue)
+{
+    t_message element = t_message();
+
+    STEST_CHECK(!queue.is_attached());
+    STEST_CHECK(queue.push(element) == BUFFER_OVERFLOW);
+    STEST_CHECK(queue.push_stream(element) == BUFFER_OVERFLOW);
+    STEST_CHECK(queue.front() == nullptr);
+    queue.pop();
+    STEST_CHECK(queue.size() == 0U);
+    STEST_CHECK(queue.empty());
+}
+
+static void test_not_attached()
+{
+    SShmQueue<t_message, 64, SHM_MPSC> mpsc;
+    SShmQueue<t_message, 64, SHM_SPSC> spsc;
+    char path[64];
+
+    check_not_attached(mpsc);
+    check_not_attached(spsc);
+
+    queue_path(path, sizeof(path), "detached");
+    STEST_CHECK(spsc.create(path, SMEM_FILE));
+    STEST_CHECK(spsc.push(t_message()) == BUFFER_OK);
+    spsc.detach();
+    check_not_attached(spsc);
+    SShmQueue<t_message, 64, SHM_SPSC>::remove(path, SMEM_FILE);
+}
+
+/*****************************************************************************/
+
+/* Main Function */
+
+int main()
+{
+    test_stream_enabled();
+    test_mpsc_stream_order();
+    test_spsc_stream_payload();
+    test_not_attached();
+
+    return STEST_RESULT("test_shmqueue");
+}
@@ -0,0 +1,218 @@
+
+/**
+ * @file    test_snapshot.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    17-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * SQueue snapshot() and restore() round trip tests: wrapped buffer, empty
+ * Queue, snapshot not valid for the Queue and short reads.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2022 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ libraries
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+// Static Queue
+#include "squeue.hpp"
+
+// Test checks
+#include "stest.hpp"
+
+/*****************************************************************************/
+
+/* Test Helpers */
+
+/**
+ * @brief In memory snapshot stream.
+ */
+struct t_stream
+{
+    std::vector<uint8_t> bytes;
+    size_t read_offset = 0U;
+    size_t writes = 0U;
+
+    bool write(const void* data, size_t size)
+    {
+        const uint8_t* p = static_cast<const uint8_t*>(data);
+        bytes.insert(bytes.end(), p, p + size);
+        writes = writes + 1U;
+        return true;
+    }
+
+    bool read(void* data, size_t size)
+    {
+        if ( size > (bytes.size() - read_offset) )
+            return false;
+        std::memcpy(data, &(bytes[read_offset]), size);
+        read_offset = read_offset + size;
+        return true;
+    }
+};
+
+template <typename T_QUEUE>
+static bool save(const T_QUEUE& queue, t_stream& stream)
+{
+    return queue.snapshot(
+        [&](const void* data, size_t size)
+        { return stream.write(data, size); });
+}
+
+template <typename T_QUEUE>
+static bool load(T_QUEUE& queue, t_stream& stream)
+{
+    return queue.restore(
+        [&](void* data, size_t size)
+        { return stream.read(data, size); });
+}
+
+/*****************************************************************************/
+
+/* Tests */
+
+static void test_wrapped_round_trip()
+{
+    SQueue<uint32_t, 8> source;
+    SQueue<uint32_t, 8> target;
+    t_stream stream;
+
+    // Front at buffer position 5, back wrapped to position 2
+    for ( uint32_t i = 0U; i < 10U; i++ )
+        source.push(i);
+    source.pop();
+    source.pop();
+
+    STEST_CHECK(save(source, stream));
+    STEST_CHECK(stream.writes == 3U);
+
+    target.push(99U);
+    STEST_CHECK(load(target, stream));
+    STEST_CHECK(target.size() == 6U);
+    for ( uint32_t i = 0U; i < target.size(); i++ )
+        STEST_CHECK(target[i] == (4U + i));
+
+    // The restored Queue keeps working as a circular buffer
+    for ( uint32_t i = 10U; i < 17U; i++ )
+        target.push(i);
+    STEST_CHECK(target.size() == 8U);
+    STEST_CHECK(*(target.front()) == 9U);
+    STEST_CHECK(*(target.back()) == 16U);
+}
+
+static void test_empty_round_trip()
+{
+    SQueue<uint32_t, 8> source;
+    SQueue<uint32_t, 8> target;
+    t_stream stream;
+
+    STEST_CHECK(save(source, stream));
+    STEST_CHECK(stream.writes == 1U);
+    STEST_CHECK(stream.bytes.size() == sizeof(t_squeue_snapshot));
+
+    target.push(1U);
+    STEST_CHECK(load(target, stream));
+    STEST_CHECK(target.empty());
+    STEST_CHECK(target.front() == nullptr);
+}
+
+static void test_invalid_snapshot()
+{
+    SQueue<uint32_t, 8> source;
+    SQueue<uint32_t, 4> small;
+    SQueue<uint16_t, 8> narrow;
+    SQueue<uint32_t, 8> target;
+    t_stream stream;
+
+    for ( uint32_t i = 0U; i < 6U; i++ )
+        source.push(i);
+    STEST_CHECK(save(source, stream));
+
+    // More elements than the Queue capacity
+    small.push(1U);
+    STEST_CHECK(!load(small, stream));
+    STEST_CHECK(small.empty());
+
+    // Different element size
+    stream.read_offset = 0U;
+    narrow.push(1U);
+    STEST_CHECK(!load(narrow, stream));
+    STEST_CHECK(narrow.empty());
+
+    // Bad magic number
+    stream.read_offset = 0U;
+    stream.bytes[0] = stream.bytes[0] ^ 0xFFU;
+    target.push(1U);
+    STEST_CHECK(!load(target, stream));
+    STEST_CHECK(target.empty());
+}
+
+static void test_short_read()
+{
+    SQueue<uint32_t, 8> source;
+    SQueue<uint32_t, 8> target;
+    t_stream stream;
+
+    for ( uint32_t i = 0U; i < 6U; i++ )
+        source.push(i);
+    STEST_CHECK(save(source, stream));
+    const std::vector<uint8_t> full = stream.bytes;
+
+    // Truncated elements
+    stream.bytes.resize(full.size() - 1U);
+    target.push(1U);
+    STEST_CHECK(!load(target, stream));
+    STEST_CHECK(target.empty());
+
+    // Truncated header
+    stream.bytes.assign(full.begin(), full.begin() + 4);
+    stream.read_offset = 0U;
+    target.push(1U);
+    STEST_CHECK(!load(target, stream));
+    STEST_CHECK(target.empty());
+
+    // The whole snapshot still restores
+    stream.bytes = full;
+    stream.read_offset = 0U;
+    STEST_CHECK(load(target, stream));
+    STEST_CHECK(target.size() == 6U);
+    STEST_CHECK(*(target.back()) == 5U);
+}
+
+/*****************************************************************************/
+
+/* Main Function */
+
+int main()
+{
+    test_wrapped_round_trip();
+    test_empty_round_trip();
+    test_invalid_snapshot();
+    test_short_read();
+
+    return STEST_RESULT("test_snapshot");
+}
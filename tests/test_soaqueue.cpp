@@ -0,0 +1,206 @@
+/**
+ * @file    test_soaqueue.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    17-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * SoaSQueue tests against a std::deque of records: push() (with overwrites
+ * of the oldest records), pop(), front<I>(), back<I>(), at<I>() and both
+ * for_each_segment<I>() overloads on every column, for power of two and non
+ * power of two sizes with the indexes wrapping around.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2022 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ libraries
+#include <cstdint>
+#include <deque>
+#include <random>
+#include <vector>
+
+// Structure of arrays Queue
+#include "ssoaqueue.hpp"
+
+// Test checks
+#include "stest.hpp"
+
+/*****************************************************************************/
+
+/* Test Data Types */
+
+struct t_record
+{
+    int32_t id;
+    double value;
+    uint8_t flags;
+};
+
+/*****************************************************************************/
+
+/* Test Helpers */
+
+/**
+ * @brief Get the values of a field of the records.
+ */
+template <typename T_FIELD>
+static std::vector<T_FIELD> column(const std::deque<t_record>& model,
+        T_FIELD t_record::* field)
+{
+    std::vector<T_FIELD> values;
+
+    for ( size_t i = 0U; i < model.size(); i++ )
+        values.push_back(model[i].*field);
+
+    return values;
+}
+
+/**
+ * @brief Check the field I column through front<I>(), back<I>(), at<I>()
+ * and both for_each_segment<I>() overloads.
+ */
+template <size_t I, typename T_QUEUE, typename T_FIELD>
+static void check_column(T_QUEUE& queue, const std::deque<t_record>& model,
+        T_FIELD t_record::* field)
+{
+    const T_QUEUE& const_queue = queue;
+    std::vector<T_FIELD> expected = column(model, field);
+    std::vector<T_FIELD> segments;
+    std::vector<T_FIELD> const_segments;
+    uint32_t calls = 0U;
+
+    if ( model.empty() )
+    {
+        STEST_CHECK(queue.template front<I>() == nullptr);
+        STEST_CHECK(queue.template back<I>() == nullptr);
+    }
+    else
+    {
+        STEST_CHECK(*(queue.template front<I>()) == expected.front());
+        STEST_CHECK(*(queue.template back<I>()) == expected.back());
+    }
+    for ( size_t i = 0U; i < expected.size(); i++ )
+    {
+        STEST_CHECK(*(queue.template at<I>(i)) == expected[i]);
+        STEST_CHECK(*(const_queue.template at<I>(i)) == expected[i]);
+    }
+    STEST_CHECK(queue.template at<I>(queue.size()) == nullptr);
+
+    queue.template for_each_segment<I>([&](T_FIELD* data, size_t n)
+    {
+        calls = calls + 1U;
+        segments.insert(segments.end(), data, data + n);
+    });
+    const_queue.template for_each_segment<I>(
+            [&](const T_FIELD* data, size_t n)
+    {
+        const_segments.insert(const_segments.end(), data, data + n);
+    });
+    STEST_CHECK(segments == expected);
+    STEST_CHECK(const_segments == expected);
+    STEST_CHECK(calls <= 2U);
+}
+
+/**
+ * @brief Random pushes and pops compared with a std::deque of records.
+ */
+template <uint64_t QUEUE_SIZE>
+static void run_against_model(uint32_t seed)
+{
+    static SoaSQueue<QUEUE_SIZE, int32_t, double, uint8_t> queue;
+    std::deque<t_record> model;
+    std::mt19937 rng(seed);
+    int32_t next_id = 0;
+
+    queue.clear();
+    for ( uint32_t step = 0U; step < 5000U; step++ )
+    {
+        if ( (rng() % 100U) < 55U )
+        {
+            t_record record = { next_id, next_id * 0.5,
+                    static_cast<uint8_t>(rng()) };
+
+            next_id = next_id + 1;
+            STEST_CHECK(queue.push(record.id, record.value, record.flags) ==
+                    ( (model.size() == QUEUE_SIZE) ?
+                      BUFFER_OVERFLOW : BUFFER_OK ));
+            if ( model.size() == QUEUE_SIZE )
+                model.pop_front();
+            model.push_back(record);
+        }
+        else
+        {
+            queue.pop();
+            if ( !model.empty() )
+                model.pop_front();
+        }
+
+        STEST_CHECK(queue.size() == model.size());
+        STEST_CHECK(queue.empty() == model.empty());
+        check_column<0>(queue, model, &t_record::id);
+        check_column<1>(queue, model, &t_record::value);
+        check_column<2>(queue, model, &t_record::flags);
+        if ( stest_failures != 0 )
+            return;
+    }
+}
+
+/*****************************************************************************/
+
+/* Tests */
+
+/**
+ * @brief Write through the field references of the front and back records.
+ */
+static void test_write_fields()
+{
+    SoaSQueue<4, int32_t, double> queue;
+
+    for ( int32_t i = 0; i < 6; i++ )
+        queue.push(i, i * 2.0);
+    *(queue.front<1>()) = -1.0;
+    *(queue.back<0>()) = 50;
+    STEST_CHECK(*(queue.at<1>(0U)) == -1.0);
+    STEST_CHECK(*(queue.at<0>(3U)) == 50);
+    STEST_CHECK(*(queue.front<0>()) == 2);
+    STEST_CHECK(*(queue.back<1>()) == 10.0);
+}
+
+/*****************************************************************************/
+
+/* Main Function */
+
+int main()
+{
+    test_write_fields();
+    for ( uint32_t seed = 1U; seed <= 3U; seed++ )
+    {
+        run_against_model<1>(seed);
+        run_against_model<5>(seed);
+        run_against_model<8>(seed);
+        run_against_model<100>(seed);
+    }
+
+    return STEST_RESULT("test_soaqueue");
+}
@@ -0,0 +1,260 @@
+/**
+ * @file    test_squeue.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    17-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * SQueue element access tests against a std::deque, for power of two and
+ * non power of two sizes with the indexes wrapping around: at() (with
+ * at(size()) out of range), the iterators (forward, backward, random access
+ * and std::sort), both for_each_segment() overloads (also on a runtime
+ * size Queue), and the equality of iterators of different Queues.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2022 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ libraries
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <random>
+
+// Static Queue and runtime size Queue
+#include "sheapstorage.hpp"
+
+// Test checks
+#include "stest.hpp"
+
+/*****************************************************************************/
+
+/* Test Helpers */
+
+/**
+ * @brief Check the Queue elements through each access method.
+ */
+template <typename T_QUEUE>
+static void check_elements(T_QUEUE& queue, const std::deque<int32_t>& model)
+{
+    const T_QUEUE& const_queue = queue;
+    std::deque<int32_t> segments;
+    std::deque<int32_t> const_segments;
+    uint32_t calls = 0U;
+    uint32_t const_calls = 0U;
+    typename T_QUEUE::iterator it;
+    typename T_QUEUE::const_iterator const_it;
+    size_t i;
+
+    STEST_CHECK(queue.size() == model.size());
+    STEST_CHECK(queue.at(queue.size()) == nullptr);
+    STEST_CHECK(const_queue.at(queue.size()) == nullptr);
+    for ( i = 0U; i < model.size(); i++ )
+    {
+        STEST_CHECK((queue.at(i) != nullptr) && (*(queue.at(i)) == model[i]));
+        STEST_CHECK(queue[i] == model[i]);
+    }
+
+    // Forward, backward and random access iteration
+    STEST_CHECK(static_cast<size_t>(queue.end() - queue.begin()) ==
+            model.size());
+    STEST_CHECK(std::equal(queue.begin(), queue.end(), model.begin()));
+    STEST_CHECK(std::equal(const_queue.begin(), const_queue.end(),
+            model.begin()));
+    it = queue.end();
+    for ( i = model.size(); i > 0U; i-- )
+    {
+        --it;
+        STEST_CHECK(*it == model[i - 1U]);
+    }
+    STEST_CHECK(it == queue.begin());
+    const_it = queue.cbegin();
+    for ( i = 0U; i < model.size(); i = i + 3U )
+        STEST_CHECK(const_it[static_cast<std::ptrdiff_t>(i)] == model[i]);
+
+    // Mutable and const segments
+    queue.for_each_segment([&](int32_t* data, size_t n)
+    {
+        calls = calls + 1U;
+        segments.insert(segments.end(), data, data + n);
+    });
+    const_queue.for_each_segment([&](const int32_t* data, size_t n)
+    {
+        const_calls = const_calls + 1U;
+        const_segments.insert(const_segments.end(), data, data + n);
+    });
+    STEST_CHECK(segments == model);
+    STEST_CHECK(const_segments == model);
+    STEST_CHECK(calls <= 2U);
+    STEST_CHECK(calls == const_calls);
+    STEST_CHECK((calls == 0U) == model.empty());
+}
+
+/**
+ * @brief Random pushes (with overwrites) and pops, and sometimes a sort of
+ * the Queue elements, compared with a std::deque.
+ */
+template <uint64_t QUEUE_SIZE>
+static void run_against_model(uint32_t seed)
+{
+    static SQueue<int32_t, QUEUE_SIZE> queue;
+    std::deque<int32_t> model;
+    std::mt19937 rng(seed);
+
+    queue.clear();
+    for ( uint32_t step = 0U; step < 5000U; step++ )
+    {
+        uint32_t op = rng() % 100U;
+
+        if ( op < 55U )
+        {
+            int32_t value = static_cast<int32_t>(rng() % 1000U);
+
+            STEST_CHECK(queue.push(value) ==
+                    ( (model.size() == QUEUE_SIZE) ?
+                      BUFFER_OVERFLOW : BUFFER_OK ));
+            if ( model.size() == QUEUE_SIZE )
+                model.pop_front();
+            model.push_back(value);
+        }
+        else if ( op < 98U )
+        {
+            queue.pop();
+            if ( !model.empty() )
+                model.pop_front();
+        }
+        else
+        {
+            std::sort(queue.begin(), queue.end());
+            std::sort(model.begin(), model.end());
+        }
+
+        check_elements(queue, model);
+        if ( stest_failures != 0 )
+            return;
+    }
+}
+
+/*****************************************************************************/
+
+/* Tests */
+
+static void test_iterators_of_different_queues()
+{
+    typedef SQueue<int32_t, 8> t_queue;
+    static t_queue first;
+    static t_queue second;
+    t_queue::iterator none;
+
+    first.push(1);
+    second.push(1);
+    STEST_CHECK(first.begin() == first.begin());
+    STEST_CHECK(first.cbegin() == first.begin());
+    STEST_CHECK(first.begin() != second.begin());
+    STEST_CHECK(!(first.end() == second.end()));
+    STEST_CHECK(first.begin() != none);
+    STEST_CHECK(none == t_queue::iterator());
+}
+
+/**
+ * @brief A full Queue whose front is at the last buffer position is split
+ * in two segments, of one element and of QUEUE_SIZE-1 elements, and when
+ * the front is at the first position there is only one segment.
+ */
+static void test_segments_at_wrap()
+{
+    static SQueue<int32_t, 100> queue;
+    size_t sizes[2] = { 0U, 0U };
+    uint32_t calls = 0U;
+
+    for ( int32_t i = 0; i < 198; i++ )
+        queue.push(i);
+    queue.for_each_segment([&](int32_t*, size_t n)
+    {
+        if ( calls < 2U )
+            sizes[calls] = n;
+        calls = calls + 1U;
+    });
+    STEST_CHECK((calls == 2U) && (sizes[0] == 1U) && (sizes[1] == 99U));
+    STEST_CHECK(*(queue.front()) == 98);
+
+    // One more element moves the front to the buffer start
+    queue.push(198);
+    calls = 0U;
+    queue.for_each_segment([&](int32_t*, size_t n)
+    {
+        if ( calls < 2U )
+            sizes[calls] = n;
+        calls = calls + 1U;
+    });
+    STEST_CHECK((calls == 1U) && (sizes[0] == 100U));
+    STEST_CHECK(*(queue.front()) == 99);
+    STEST_CHECK(*(queue.at(99U)) == 198);
+    STEST_CHECK(queue.at(100U) == nullptr);
+}
+
+/**
+ * @brief Runtime size Queue segments follow its storage capacity, across
+ * several wrap-arounds of the indexes.
+ */
+static void test_runtime_size_segments()
+{
+    SDynQueue<int32_t> queue(64U);
+    std::deque<int32_t> model;
+
+    for ( int32_t i = 0; i < 300; i++ )
+    {
+        queue.push(i);
+        model.push_back(i);
+        if ( model.size() > 64U )
+            model.pop_front();
+        if ( (i % 7) == 0 )
+        {
+            queue.pop();
+            model.pop_front();
+        }
+        check_elements(queue, model);
+        if ( stest_failures != 0 )
+            return;
+    }
+}
+
+/*****************************************************************************/
+
+/* Main Function */
+
+int main()
+{
+    test_iterators_of_different_queues();
+    test_segments_at_wrap();
+    test_runtime_size_segments();
+    for ( uint32_t seed = 1U; seed <= 3U; seed++ )
+    {
+        run_against_model<3>(seed);
+        run_against_model<16>(seed);
+        run_against_model<100>(seed);
+        run_against_model<129>(seed);
+    }
+
+    return STEST_RESULT("test_squeue");
+}
@@ -0,0 +1,184 @@
+/**
+ * @file    test_windowquantile.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    17-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * SWindowQuantile tests against a sorted copy of the window: kth() for
+ * every rank (and out of range), quantile() with the nearest rank method for
+ * quantiles in and out of the range 0.0 to 1.0 (and NaN), and median(), with
+ * many duplicated values and windows that slide several times.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2022 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ libraries
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <random>
+#include <vector>
+
+// Sliding window quantiles
+#include "swindowquantile.hpp"
+
+// Test checks
+#include "stest.hpp"
+
+/*****************************************************************************/
+
+/* Test Helpers */
+
+/**
+ * @brief Reference quantile of a sorted window, nearest rank method with
+ * the quantile clamped to the range 0.0 to 1.0.
+ */
+static int32_t model_quantile(const std::vector<int32_t>& sorted, double q)
+{
+    size_t rank;
+
+    if ( std::isnan(q) || (q < 0.0) )
+        q = 0.0;
+    if ( q > 1.0 )
+        q = 1.0;
+    rank = static_cast<size_t>(std::ceil(q * sorted.size()));
+    if ( rank > 0U )
+        rank = rank - 1U;
+
+    return sorted[rank];
+}
+
+/**
+ * @brief Check every order statistic of the window.
+ */
+template <uint32_t WINDOW_SIZE>
+static void check_window(const SWindowQuantile<int32_t, WINDOW_SIZE>& tracker,
+        const std::deque<int32_t>& window)
+{
+    static const double QUANTILES[] = { 0.0, 0.01, 0.1, 0.25, 0.5, 0.75,
+            0.9, 0.95, 0.99, 1.0, -0.5, 1.5, -1.0e300, 1.0e300,
+            std::numeric_limits<double>::infinity(),
+            -std::numeric_limits<double>::infinity(),
+            std::numeric_limits<double>::quiet_NaN() };
+    std::vector<int32_t> sorted(window.begin(), window.end());
+    uint32_t n = static_cast<uint32_t>(sorted.size());
+
+    std::sort(sorted.begin(), sorted.end());
+    STEST_CHECK(tracker.size() == n);
+    STEST_CHECK(tracker.kth(n) == nullptr);
+    if ( n == 0U )
+    {
+        STEST_CHECK(tracker.median() == nullptr);
+        STEST_CHECK(tracker.quantile(0.5) == nullptr);
+        return;
+    }
+
+    for ( uint32_t k = 0U; k < n; k++ )
+    {
+        STEST_CHECK((tracker.kth(k) != nullptr) &&
+                (*(tracker.kth(k)) == sorted[k]));
+    }
+    for ( size_t i = 0U; i < (sizeof(QUANTILES) / sizeof(QUANTILES[0])); i++ )
+    {
+        const int32_t* value = tracker.quantile(QUANTILES[i]);
+
+        STEST_CHECK((value != nullptr) &&
+                (*value == model_quantile(sorted, QUANTILES[i])));
+    }
+    STEST_CHECK(*(tracker.median()) == sorted[(n - 1U) / 2U]);
+}
+
+/**
+ * @brief Random pushes and pops of values with many duplicates.
+ */
+template <uint32_t WINDOW_SIZE>
+static void run_against_model(uint32_t seed, uint32_t num_distinct)
+{
+    static SWindowQuantile<int32_t, WINDOW_SIZE> tracker;
+    std::deque<int32_t> window;
+    std::mt19937 rng(seed);
+
+    tracker.clear();
+    for ( uint32_t step = 0U; step < 3000U; step++ )
+    {
+        if ( (rng() % 100U) < 80U )
+        {
+            int32_t value = static_cast<int32_t>(rng() % num_distinct) - 3;
+
+            tracker.push(value);
+            if ( window.size() == WINDOW_SIZE )
+                window.pop_front();
+            window.push_back(value);
+        }
+        else
+        {
+            tracker.pop();
+            if ( !window.empty() )
+                window.pop_front();
+        }
+
+        check_window(tracker, window);
+        if ( stest_failures != 0 )
+            return;
+    }
+}
+
+/*****************************************************************************/
+
+/* Tests */
+
+static void test_quantile_out_of_range()
+{
+    static SWindowQuantile<int32_t, 4> tracker;
+
+    tracker.push(10);
+    tracker.push(20);
+    tracker.push(30);
+    STEST_CHECK(*(tracker.quantile(-1.0)) == 10);
+    STEST_CHECK(*(tracker.quantile(std::nan(""))) == 10);
+    STEST_CHECK(*(tracker.quantile(1.0e12)) == 30);
+    STEST_CHECK(*(tracker.quantile(0.34)) == 20);
+    STEST_CHECK(*(tracker.quantile(0.33)) == 10);
+}
+
+/*****************************************************************************/
+
+/* Main Function */
+
+int main()
+{
+    test_quantile_out_of_range();
+    for ( uint32_t seed = 1U; seed <= 3U; seed++ )
+    {
+        run_against_model<1>(seed, 4U);
+        run_against_model<7>(seed, 3U);
+        run_against_model<64>(seed, 10U);
+        run_against_model<100>(seed, 1000U);
+    }
+
+    return STEST_RESULT("test_windowquantile");
+}